@@ -24,164 +24,1957 @@
 
 #endif
 
+#if ((PORT_ATOMIC_ACCESS == STD_ON) && (PORT_EXCLUSIVE_AREAS == STD_ON))
+#error "PORT_ATOMIC_ACCESS and PORT_EXCLUSIVE_AREAS are alternatives, enable only one of them"
+#endif
+
+#if (PORT_EXCLUSIVE_AREAS == STD_ON)
+#include "SchM_Port.h"
+#define PORT_ENTER_EXCLUSIVE_AREA()    SchM_Enter_Port_PORT_EXCLUSIVE_AREA_0()
+#define PORT_EXIT_EXCLUSIVE_AREA()     SchM_Exit_Port_PORT_EXCLUSIVE_AREA_0()
+#else
+#define PORT_ENTER_EXCLUSIVE_AREA()
+#define PORT_EXIT_EXCLUSIVE_AREA()
+#endif
+
+#if (PORT_TRACE == STD_ON)
+#if ((PORT_TRACE_RECORDS & (PORT_TRACE_RECORDS - 1U)) != 0)
+#error "PORT_TRACE_RECORDS must be a power of two"
+#endif
+/* A traced service samples the register store counter on entry and records its call on exit */
+#define PORT_TRACE_BEGIN()                          uint32 trace_Stores = PORT_ATOMIC_LOAD(&Port_TraceStores)
+#define PORT_TRACE_END(ServiceId, Pin, Argument)    Port_TraceRecord((ServiceId), (uint8)(Pin), (uint16)(Argument), trace_Stores)
+#else
+#define PORT_TRACE_BEGIN()
+#define PORT_TRACE_END(ServiceId, Pin, Argument)
+#endif
+
 STATIC const Port_ConfigPin * Port_Pins = NULL_PTR;
 STATIC uint8 Port_Status = PORT_NOT_INITIALIZED;
 
+/* Register images, safe state images and used ports of the active configuration, and the CRC of the images */
+STATIC const Port_PortImageType * Port_Images = NULL_PTR;
+STATIC const Port_PortImageType * Port_SafeImages = NULL_PTR;
+STATIC uint8 Port_ClockMask = 0;
+STATIC uint32 Port_ConfigCrc = 0;
+
+/* Resolved registers of every configured pin, indexed by the Port Pin ID */
+STATIC Port_PinDescType Port_PinDesc[PORT_CONFIGURED_PINS];
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+/* Modes supported by every pin, indexed by the port and pin number, a mode is checked with a single bit test */
+STATIC const uint16 Port_PinModes[PORT_NUMBER_OF_PORTS][PORT_PINS_PER_PORT] =
+{
+		PORT_PIN_MODES_TABLE(PORT_PIN_MODES_INITIALIZER, 0, 0)
+};
+#define PORT_PIN_SUPPORTS_MODE(Pin, Mode) \
+	((Port_PinModes[Port_PinDesc[Pin].port_Num][Port_PinDesc[Pin].pin_Num] & PORT_MODE_BIT(Mode)) != 0U)
+#endif
+
+#if (PORT_AHB_APERTURE == STD_ON)
+/* Ports of the active configuration accessed through the AHB aperture */
+STATIC uint8 Port_AhbMask = 0;
+
+/* GPIO ports APB base addresses indexed by the port number */
+STATIC const uint32 Port_ApbBaseAddress[PORT_NUMBER_OF_PORTS] =
+{
+		GPIO_PORTA_BASE_ADDRESS, GPIO_PORTB_BASE_ADDRESS, GPIO_PORTC_BASE_ADDRESS,
+		GPIO_PORTD_BASE_ADDRESS, GPIO_PORTE_BASE_ADDRESS, GPIO_PORTF_BASE_ADDRESS
+};
+
+/* GPIO ports AHB base addresses indexed by the port number */
+STATIC const uint32 Port_AhbBaseAddress[PORT_NUMBER_OF_PORTS] =
+{
+		GPIO_PORTA_AHB_BASE_ADDRESS, GPIO_PORTB_AHB_BASE_ADDRESS, GPIO_PORTC_AHB_BASE_ADDRESS,
+		GPIO_PORTD_AHB_BASE_ADDRESS, GPIO_PORTE_AHB_BASE_ADDRESS, GPIO_PORTF_AHB_BASE_ADDRESS
+};
+#endif
+
+/* Base addresses of the aperture every port is accessed through, the APB until Port_Init selects the AHB */
+STATIC uint32 Port_BaseAddress[PORT_NUMBER_OF_PORTS] =
+{
+		GPIO_PORTA_BASE_ADDRESS, GPIO_PORTB_BASE_ADDRESS, GPIO_PORTC_BASE_ADDRESS,
+		GPIO_PORTD_BASE_ADDRESS, GPIO_PORTE_BASE_ADDRESS, GPIO_PORTF_BASE_ADDRESS
+};
+
+/* Current value of the configuration registers of every port, indexed like a port register image.
+ * Seeded by Port_Init and kept by every service that writes them, so the query services never read the bus.
+ * GPIODATA holds pin levels rather than configuration and its entry is not used */
+STATIC uint32 Port_Shadow[PORT_NUMBER_OF_PORTS][PORT_IMAGE_REGS];
+
+/* Bits of the configuration registers of every port the changeable services may change at runtime,
+ * indexed like a port register image. Port_VerifyConfiguration expects them as the shadow holds them
+ * and every other bit as configured */
+STATIC uint32 Port_RuntimeMask[PORT_NUMBER_OF_PORTS][PORT_IMAGE_REGS];
+
+/* Pins of every port refreshed by Port_RefreshPortDirection, their configured GPIODIR bits,
+ * and the number of times the refresh found them drifted */
+STATIC uint8 Port_RefreshMask[PORT_NUMBER_OF_PORTS];
+STATIC uint8 Port_RefreshDir[PORT_NUMBER_OF_PORTS];
+STATIC uint32 Port_DriftCount[PORT_NUMBER_OF_PORTS];
+
+/* Ports with refreshed pins in refresh order, the next one Port_RefreshPortDirection services,
+ * and the number of completed sweeps over all of them */
+STATIC uint8 Port_RefreshPorts[PORT_NUMBER_OF_PORTS];
+STATIC uint8 Port_RefreshPortCount = 0;
+STATIC uint8 Port_RefreshCursor = 0;
+STATIC uint32 Port_SweepCount = 0;
+
+/* Register images of the changes staged while an update is open, and the ports they touch */
+STATIC Port_PortImageType Port_Staged[PORT_NUMBER_OF_PORTS];
+STATIC uint8 Port_StagedPorts = 0;
+STATIC boolean Port_UpdateOpen = FALSE;
+
+/* Ports whose clock the driver enabled in RCGC2 */
+STATIC uint8 Port_ClockOn = 0;
+
+/* Ports whose pad registers (drive strength, open drain, slew rate) are held in the RAM shadow */
+STATIC uint8 Port_PadShadowed = 0;
+
+/* Configuration registers and pin levels of the used ports saved by Port_EnterSafeState */
+STATIC Port_PortSnapshotType Port_Saved[PORT_NUMBER_OF_PORTS];
+STATIC uint8 Port_SavedData[PORT_NUMBER_OF_PORTS];
+STATIC boolean Port_SafeState = FALSE;
+
+#if (PORT_TRACE == STD_ON)
+/* Trace ring buffer of the service calls, and the register stores made by the driver since reset */
+Port_TraceBufferType Port_Trace;
+uint32 Port_TraceStores = 0;
+#endif
+
+/* GPIO registers offsets indexed by their position inside a port register image */
+STATIC const uint16 Port_ImageRegOffset[PORT_IMAGE_REGS] =
+{
+		PORT_DATA_REG_OFFSET, PORT_CTL_REG_OFFSET, PORT_ALT_FUNC_REG_OFFSET, PORT_ANALOG_MODE_SEL_REG_OFFSET,
+		PORT_DIGITAL_ENABLE_REG_OFFSET, PORT_PULL_UP_REG_OFFSET, PORT_PULL_DOWN_REG_OFFSET, PORT_DIR_REG_OFFSET,
+		PORT_DRIVE_2MA_REG_OFFSET, PORT_DRIVE_4MA_REG_OFFSET, PORT_DRIVE_8MA_REG_OFFSET, PORT_OPEN_DRAIN_REG_OFFSET,
+		PORT_SLEW_RATE_REG_OFFSET
+};
+
+/************************************************************************************
+ * Function Name: Port_ClockEnable
+ * Description: Enables the clock of the given ports that are not clocked yet, with one
+ *              read-modify-write of RCGC2, and waits until PRGPIO reports them ready,
+ *              which is as long as the clocks take to start and no longer
+ ************************************************************************************/
+STATIC void Port_ClockEnable(uint8 Ports)
+{
+	uint8 new_Ports = Ports & (uint8)~PORT_ATOMIC_LOAD(&Port_ClockOn);
+
+	if(new_Ports != 0)
+	{
+#if (PORT_ATOMIC_ACCESS == STD_ON)
+		/* RCGC2 also holds the clocks of other peripherals, its current value is only known once read */
+		uint32 rcgc2 = PORT_REG_READ(SYSCTL_REGCGC2_ADDRESS);
+		while(PORT_REG_COMPARE_EXCHANGE(SYSCTL_REGCGC2_ADDRESS, &rcgc2, rcgc2 | new_Ports) == FALSE)
+		{
+			/* RCGC2 changed since it was read, retry with its current value */
+		}
+#else
+		PORT_REG_WRITE(SYSCTL_REGCGC2_ADDRESS, PORT_REG_READ(SYSCTL_REGCGC2_ADDRESS) | new_Ports);
+#endif
+		while((PORT_REG_READ(SYSCTL_PRGPIO_ADDRESS) & new_Ports) != new_Ports)
+		{
+			/* Wait for the ports to be ready */
+		}
+		PORT_ATOMIC_OR(&Port_ClockOn, new_Ports);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+#if (PORT_CLOCK_GATING == STD_ON)
+/************************************************************************************
+ * Function Name: Port_ClockGateIdle
+ * Description: Gates the clock of the idle ports, the clocked ports without any digitally
+ *              enabled pin in the RAM shadow of GPIODEN, with one read-modify-write of RCGC2.
+ *              A gated port keeps its registers, so its pins keep their analog or
+ *              disabled configuration, and it is clocked again before its next access
+ ************************************************************************************/
+STATIC void Port_ClockGateIdle(void)
+{
+	uint8 idle_Ports = 0;
+
+	for(uint8 port_Num = 0; port_Num < PORT_NUMBER_OF_PORTS; port_Num++)
+	{
+		if((Port_ClockOn & (1U << port_Num)) && (Port_Shadow[port_Num][PORT_IMAGE_DIGITAL_ENABLE] == 0))
+		{
+			idle_Ports |= (uint8)(1U << port_Num);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	if(idle_Ports != 0)
+	{
+		PORT_REG_WRITE(SYSCTL_REGCGC2_ADDRESS, PORT_REG_READ(SYSCTL_REGCGC2_ADDRESS) & ~(uint32)idle_Ports);
+		Port_ClockOn &= (uint8)~idle_Ports;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Port_SeedPad
+ * Description: Reads the pad registers of a port into its shadow the first time an image
+ *              with pad bits is applied to it, so the ports without configured pins never
+ *              read them
+ ************************************************************************************/
+STATIC void Port_SeedPad(uint8 port_Num, const Port_PortImageType * Image)
+{
+	uint32 pad_Mask = 0;
+
+	for(uint8 reg = PORT_IMAGE_PAD_FIRST; reg < PORT_IMAGE_REGS; reg++)
+	{
+		pad_Mask |= Image->Regs[reg].mask;
+	}
+	if((pad_Mask != 0) && ((Port_PadShadowed & (1U << port_Num)) == 0))
+	{
+#if (PORT_CLOCK_GATING == STD_ON)
+		Port_ClockEnable((uint8)(1U << port_Num));
+#endif
+		for(uint8 reg = PORT_IMAGE_PAD_FIRST; reg < PORT_IMAGE_REGS; reg++)
+		{
+			Port_Shadow[port_Num][reg] = PORT_REG_READ(Port_BaseAddress[port_Num] + Port_ImageRegOffset[reg]);
+		}
+		Port_PadShadowed |= (uint8)(1U << port_Num);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+ * Function Name: Port_ProgramPort
+ * Description: Writes a port register image to the GPIO registers of one port, one
+ *              store per register that has bits to be programmed. The unprogrammed
+ *              bits are taken from the RAM shadow, so the registers are not read back
+ ************************************************************************************/
+STATIC void Port_ProgramPort(uint8 port_Num, const Port_PortImageType * Image)
+{
+	uint32 PortGpio_Base = Port_BaseAddress[port_Num]; /* the required Port Registers base address */
+
+#if (PORT_CLOCK_GATING == STD_ON)
+	Port_ClockEnable((uint8)(1U << port_Num));
+#endif
+	Port_SeedPad(port_Num, Image);
+	if(Image->commit_Mask != 0)
+	{
+		PORT_REG_WRITE(PortGpio_Base + PORT_LOCK_REG_OFFSET, PORT_LOCK_KEY);    /* Unlock the GPIOCR register */
+		PORT_REG_WRITE(PortGpio_Base + PORT_COMMIT_REG_OFFSET,
+				PORT_REG_READ(PortGpio_Base + PORT_COMMIT_REG_OFFSET) | Image->commit_Mask);  /* Allow changes on the locked pins */
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	for(uint8 reg = 0; reg < PORT_IMAGE_REGS; reg++)
+	{
+		const Port_RegImageType * Reg = &Image->Regs[reg];
+		if(Reg->mask == 0)
+		{
+			/* No Action Required */
+		}
+		else if(reg == PORT_IMAGE_DATA)
+		{
+			/* The masked GPIODATA address only changes the masked pins, no need to read the register */
+			PORT_REG_WRITE(PortGpio_Base + PORT_DATA_MASKED_OFFSET(Reg->mask), Reg->value);
+		}
+		else
+		{
+			uint32 Reg_Value = (Port_Shadow[port_Num][reg] & ~Reg->mask) | Reg->value;
+			PORT_REG_WRITE(PortGpio_Base + Port_ImageRegOffset[reg], Reg_Value);
+			Port_Shadow[port_Num][reg] = Reg_Value;
+			/* Setting a pull up clears the pull down of the pin, and the other way round */
+			if(reg == PORT_IMAGE_PULL_UP)
+			{
+				Port_Shadow[port_Num][PORT_IMAGE_PULL_DOWN] &= ~Reg_Value;
+			}
+			else if(reg == PORT_IMAGE_PULL_DOWN)
+			{
+				Port_Shadow[port_Num][PORT_IMAGE_PULL_UP] &= ~Reg_Value;
+			}
+			else if((reg >= PORT_IMAGE_DRIVE_2MA) && (reg <= PORT_IMAGE_DRIVE_8MA))
+			{
+				/* Selecting a drive strength clears the pin in the two other drive registers */
+				for(uint8 drive = PORT_IMAGE_DRIVE_2MA; drive <= PORT_IMAGE_DRIVE_8MA; drive++)
+				{
+					if(drive != reg)
+					{
+						Port_Shadow[port_Num][drive] &= ~Reg_Value;
+					}
+					else
+					{
+						/* No Action Required */
+					}
+				}
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+}
+
+/************************************************************************************
+ * Function Name: Port_ImageWrite
+ * Description: Records the value of the masked bits of one register inside a port register image
+ ************************************************************************************/
+STATIC void Port_ImageWrite(Port_RegImageType * Reg, uint32 Mask, uint32 Value)
+{
+	/* The staged images are shared by the reentrant services, the pins of other callers are kept */
+	PORT_ATOMIC_OR(&Reg->mask, Mask);
+	PORT_ATOMIC_AND(&Reg->value, ~Mask | Value);
+	PORT_ATOMIC_OR(&Reg->value, Value & Mask);
+}
+
+/************************************************************************************
+ * Function Name: Port_FoldChange
+ * Description: Folds the direction and/or mode change of one pin into the register
+ *              image of its port, with the same register bits as the generated images
+ ************************************************************************************/
+STATIC void Port_FoldChange(Port_PortImageType * Image, const Port_PinDescType * Pin_Desc, const Port_PinChangeType * Change)
+{
+	uint32 pin_Mask = Pin_Desc->pin_Mask;
+	uint32 ctl_Mask = (uint32)0x0000000F << Pin_Desc->ctl_Shift;
+
+	if(Change->change_Mask & PORT_CHANGE_MODE)
+	{
+		if(Change->pin_Mode == PORT_MODE_DIO)
+		{
+			Port_ImageWrite(&Image->Regs[PORT_IMAGE_ANALOG_MODE_SEL], pin_Mask, 0);
+			Port_ImageWrite(&Image->Regs[PORT_IMAGE_ALT_FUNC], pin_Mask, 0);
+			Port_ImageWrite(&Image->Regs[PORT_IMAGE_CTL], ctl_Mask, 0);
+			Port_ImageWrite(&Image->Regs[PORT_IMAGE_DIGITAL_ENABLE], pin_Mask, pin_Mask);
+		}
+		else if(Change->pin_Mode == PORT_MODE_ANALOG)
+		{
+			Port_ImageWrite(&Image->Regs[PORT_IMAGE_ANALOG_MODE_SEL], pin_Mask, pin_Mask);
+			Port_ImageWrite(&Image->Regs[PORT_IMAGE_DIGITAL_ENABLE], pin_Mask, 0);
+		}
+		else
+		{
+			Port_ImageWrite(&Image->Regs[PORT_IMAGE_ANALOG_MODE_SEL], pin_Mask, 0);
+			Port_ImageWrite(&Image->Regs[PORT_IMAGE_ALT_FUNC], pin_Mask, pin_Mask);
+			Port_ImageWrite(&Image->Regs[PORT_IMAGE_CTL], ctl_Mask, (uint32)Change->pin_Mode << Pin_Desc->ctl_Shift);
+			Port_ImageWrite(&Image->Regs[PORT_IMAGE_DIGITAL_ENABLE], pin_Mask, pin_Mask);
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+	if(Change->change_Mask & PORT_CHANGE_DIRECTION)
+	{
+		Port_ImageWrite(&Image->Regs[PORT_IMAGE_DIR], pin_Mask, (Change->pin_Direction == PORT_PIN_OUT) ? pin_Mask : 0);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+ * Function Name: Port_StagedImage
+ * Description: Returns the staged register image of a port and marks the port to be
+ *              written by Port_CommitUpdate
+ ************************************************************************************/
+STATIC Port_PortImageType * Port_StagedImage(uint8 port_Num)
+{
+	PORT_ATOMIC_OR(&Port_StagedPorts, (uint8)(1U << port_Num));
+	return &Port_Staged[port_Num];
+}
+
+#if (PORT_BITBAND_ACCESS == STD_ON)
+/************************************************************************************
+ * Function Name: Port_ModifyReg
+ * Description: Writes the masked bits of one configuration register of a port through
+ *              the bit-band alias, one store per bit so the other pins are never
+ *              rewritten, and keeps its RAM shadow in step
+ ************************************************************************************/
+STATIC void Port_ModifyReg(uint8 port_Num, uint8 reg, uint32 Mask, uint32 Value)
+{
+	uint32 Reg_Address = Port_BaseAddress[port_Num] + Port_ImageRegOffset[reg];
+	uint32 bits = Mask;
+
+	PORT_ATOMIC_AND(&Port_Shadow[port_Num][reg], ~Mask);
+	PORT_ATOMIC_OR(&Port_Shadow[port_Num][reg], Value);
+	for(uint8 bit = 0; bits != 0; bit++)
+	{
+		if(bits & 1U)
+		{
+			PORT_REG_WRITE(PORT_BITBAND_ALIAS_ADDRESS(Reg_Address, bit), (Value >> bit) & 1U);
+		}
+		else
+		{
+			/* No Action Required */
+		}
+		bits >>= 1;
+	}
+}
+#else
+/************************************************************************************
+ * Function Name: Port_ModifyReg
+ * Description: Writes the masked bits of one configuration register of a port and keeps
+ *              its RAM shadow in step. With PORT_ATOMIC_ACCESS the register is updated
+ *              with a compare and swap loop that starts from the shadow, one load-exclusive
+ *              and one store-exclusive when no other caller changed the register meanwhile,
+ *              otherwise with a single store of the shadow
+ ************************************************************************************/
+STATIC void Port_ModifyReg(uint8 port_Num, uint8 reg, uint32 Mask, uint32 Value)
+{
+	uint32 Reg_Address = Port_BaseAddress[port_Num] + Port_ImageRegOffset[reg];
+
+#if (PORT_ATOMIC_ACCESS == STD_ON)
+	uint32 Reg_Value = PORT_ATOMIC_LOAD(&Port_Shadow[port_Num][reg]);
+
+	while(PORT_REG_COMPARE_EXCHANGE(Reg_Address, &Reg_Value, (Reg_Value & ~Mask) | Value) == FALSE)
+	{
+		/* Another caller changed the register, retry from the value it left */
+	}
+	/* The pins of the other callers commute with this update, the shadow ends up as the register */
+	PORT_ATOMIC_AND(&Port_Shadow[port_Num][reg], ~Mask);
+	PORT_ATOMIC_OR(&Port_Shadow[port_Num][reg], Value);
+#else
+	uint32 Reg_Value = (Port_Shadow[port_Num][reg] & ~Mask) | Value;
+
+	PORT_REG_WRITE(Reg_Address, Reg_Value);
+	Port_Shadow[port_Num][reg] = Reg_Value;
+#endif
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Port_WritePad
+ * Description: Sets or clears the bit of one pin in one pad register, staged while an
+ *              update is open or written at once with a single store. The pad services
+ *              are not reentrant, the first one on a port seeds its pad shadow
+ ************************************************************************************/
+STATIC void Port_WritePad(const Port_PinDescType * Pin_Desc, uint8 reg, boolean Set)
+{
+	if(Port_UpdateOpen == TRUE)
+	{
+		Port_PortImageType * Staged = Port_StagedImage(Pin_Desc->port_Num);
+
+		if((reg >= PORT_IMAGE_DRIVE_2MA) && (reg <= PORT_IMAGE_DRIVE_8MA))
+		{
+			/* A staged drive strength replaces the one staged before for the pin */
+			for(uint8 drive = PORT_IMAGE_DRIVE_2MA; drive <= PORT_IMAGE_DRIVE_8MA; drive++)
+			{
+				Staged->Regs[drive].mask &= ~(uint32)Pin_Desc->pin_Mask;
+				Staged->Regs[drive].value &= ~(uint32)Pin_Desc->pin_Mask;
+			}
+		}
+		else
+		{
+			/* No Action Required */
+		}
+		Port_ImageWrite(&Staged->Regs[reg], Pin_Desc->pin_Mask, (Set == TRUE) ? Pin_Desc->pin_Mask : 0);
+	}
+	else
+	{
+		Port_PortImageType Image = {0};
+
+		Port_ImageWrite(&Image.Regs[reg], Pin_Desc->pin_Mask, (Set == TRUE) ? Pin_Desc->pin_Mask : 0);
+		Port_ProgramPort(Pin_Desc->port_Num, &Image);
+	}
+}
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+/************************************************************************************
+ * Function Name: Port_PadCheck
+ * Description: Tells whether the bit of a pin is set in one register, as the pin will be
+ *              once the open update is committed. The pad shadow of every port with
+ *              configured pins is seeded by Port_Init, so the bus is not read
+ ************************************************************************************/
+STATIC boolean Port_PadCheck(const Port_PinDescType * Pin_Desc, uint8 reg)
+{
+	uint32 reg_Value = Port_Shadow[Pin_Desc->port_Num][reg];
+
+	if(Port_UpdateOpen == TRUE)
+	{
+		const Port_PortImageType * Staged = &Port_Staged[Pin_Desc->port_Num];
+		uint32 staged_Mask = Staged->Regs[reg].mask;
+
+		if((reg >= PORT_IMAGE_DRIVE_2MA) && (reg <= PORT_IMAGE_DRIVE_8MA))
+		{
+			/* A staged drive strength replaces the pin in the three drive registers */
+			staged_Mask = Staged->Regs[PORT_IMAGE_DRIVE_2MA].mask | Staged->Regs[PORT_IMAGE_DRIVE_4MA].mask
+					| Staged->Regs[PORT_IMAGE_DRIVE_8MA].mask;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+		reg_Value = (reg_Value & ~staged_Mask) | (Staged->Regs[reg].value & staged_Mask);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return ((reg_Value & Pin_Desc->pin_Mask) != 0) ? TRUE : FALSE;
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Port_CrcWord
+ * Description: Folds one 32-bit word into a CRC-32 (reflected polynomial 0xEDB88320)
+ ************************************************************************************/
+STATIC uint32 Port_CrcWord(uint32 Crc, uint32 Word)
+{
+	Crc ^= Word;
+	for(uint8 bit = 0; bit < 32; bit++)
+	{
+		Crc = (Crc >> 1) ^ ((Crc & 1U) ? 0xEDB88320U : 0U);
+	}
+	return Crc;
+}
+
+/************************************************************************************
+ * Function Name: Port_RefreshPort
+ * Description: Reads GPIODIR of one port and repairs it only when one of its pins with an
+ *              unchangeable direction drifted from its configured direction. The repair sets
+ *              the drifted bits and keeps the other bits as the register holds them, a drift
+ *              of a pin with a changeable direction is left for Port_VerifyConfiguration to
+ *              report. The check and the repair run in the exclusive area, so they do not
+ *              lose a direction written meanwhile by Port_SetPinDirection
+ ************************************************************************************/
+STATIC void Port_RefreshPort(uint8 port_Num)
+{
+	uint8 refresh_Mask = Port_RefreshMask[port_Num];
+	uint32 dir_Address = Port_BaseAddress[port_Num] + PORT_DIR_REG_OFFSET;
+
+	PORT_ENTER_EXCLUSIVE_AREA();
+#if (PORT_CLOCK_GATING == STD_ON)
+	if((Port_ClockOn & (1U << port_Num)) == 0)
+	{
+		/* A gated port keeps its registers, it is checked again once it is clocked */
+	}
+	else
+#endif
+	{
+		uint32 dir_Value = PORT_REG_READ(dir_Address);
+		uint32 drift_Mask = (dir_Value ^ Port_RefreshDir[port_Num]) & refresh_Mask;
+
+		if(drift_Mask != 0)
+		{
+#if ((PORT_ATOMIC_ACCESS == STD_ON) || (PORT_BITBAND_ACCESS == STD_ON))
+			/* The compare and swap retries from the live register and the alias stores write the drifted
+			 * bits only, so the other pins keep the value read from the register */
+			Port_ModifyReg(port_Num, PORT_IMAGE_DIR, drift_Mask, Port_RefreshDir[port_Num] & drift_Mask);
+#else
+			/* Port_ModifyReg would store the shadow here and overwrite the drift of the changeable pins,
+			 * the register read above is written back with the drifted bits repaired. Only those bits of
+			 * the shadow change, Port_GetPinDirection keeps returning the last direction set */
+			PORT_REG_WRITE(dir_Address, (dir_Value & ~drift_Mask) | (Port_RefreshDir[port_Num] & drift_Mask));
+			Port_Shadow[port_Num][PORT_IMAGE_DIR] = (Port_Shadow[port_Num][PORT_IMAGE_DIR] & ~drift_Mask)
+					| (Port_RefreshDir[port_Num] & drift_Mask);
+#endif
+			Port_DriftCount[port_Num]++;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	PORT_EXIT_EXCLUSIVE_AREA();
+}
+
+/************************************************************************************
+ * Function Name: Port_LoadConfig
+ * Description: Makes a configuration the active one and resolves everything the runtime
+ *              services need from it, without any peripheral access
+ ************************************************************************************/
+STATIC void Port_LoadConfig(const Port_ConfigType * ConfigPtr)
+{
+	uint32 crc = 0xFFFFFFFFU;
+
+	Port_Pins = ConfigPtr->Pins;
+	Port_Images = ConfigPtr->Ports;
+	Port_SafeImages = ConfigPtr->Safe;
+	Port_ClockMask = ConfigPtr->clock_Mask;
+
+#if (PORT_AHB_APERTURE == STD_ON)
+	Port_AhbMask = ConfigPtr->ahb_Mask;
+	for(uint8 port_Num = 0; port_Num < PORT_NUMBER_OF_PORTS; port_Num++)
+	{
+		Port_BaseAddress[port_Num] = (ConfigPtr->ahb_Mask & (1U << port_Num)) ?
+				Port_AhbBaseAddress[port_Num] : Port_ApbBaseAddress[port_Num];
+	}
+#endif
+
+	for(uint8 port_Num = 0; port_Num < PORT_NUMBER_OF_PORTS; port_Num++)
+	{
+		Port_RefreshMask[port_Num] = 0;
+		Port_RefreshDir[port_Num] = 0;
+		for(uint8 reg = 0; reg < PORT_IMAGE_REGS; reg++)
+		{
+			Port_RuntimeMask[port_Num][reg] = 0;
+		}
+	}
+
+	/* Resolve the registers of every pin once, so the runtime services do not decode the port */
+	for(uint8 i = 0; i < PORT_CONFIGURED_PINS; i++)
+	{
+		uint8 port_Num = ConfigPtr->Pins[i].port_Num;
+		uint8 pin_Num = ConfigPtr->Pins[i].pin_Num;
+		Port_PinDesc[i].base_Address = (port_Num < PORT_NUMBER_OF_PORTS) ? Port_BaseAddress[port_Num] : 0;
+		Port_PinDesc[i].pin_Mask = (uint8)(1U << pin_Num);
+		Port_PinDesc[i].ctl_Shift = (uint8)(pin_Num * 4);
+		Port_PinDesc[i].port_Num = port_Num;
+		Port_PinDesc[i].pin_Num = pin_Num;
+
+		/* Only the pins with a fixed direction are refreshed */
+		if((port_Num < PORT_NUMBER_OF_PORTS) && (ConfigPtr->Pins[i].pin_Direction_Changeable == FALSE))
+		{
+			Port_RefreshMask[port_Num] |= Port_PinDesc[i].pin_Mask;
+			if(ConfigPtr->Pins[i].pin_Direction == PORT_PIN_OUT)
+			{
+				Port_RefreshDir[port_Num] |= Port_PinDesc[i].pin_Mask;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+		else if(port_Num < PORT_NUMBER_OF_PORTS)
+		{
+			Port_RuntimeMask[port_Num][PORT_IMAGE_DIR] |= Port_PinDesc[i].pin_Mask;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+
+		/* The registers Port_SetPinMode writes for the pin, and its pad registers unless it stays analog */
+		if((port_Num < PORT_NUMBER_OF_PORTS) && (ConfigPtr->Pins[i].pin_Mode_Changeable == TRUE))
+		{
+			Port_RuntimeMask[port_Num][PORT_IMAGE_CTL] |= (uint32)0x0000000F << Port_PinDesc[i].ctl_Shift;
+			Port_RuntimeMask[port_Num][PORT_IMAGE_ALT_FUNC] |= Port_PinDesc[i].pin_Mask;
+			Port_RuntimeMask[port_Num][PORT_IMAGE_ANALOG_MODE_SEL] |= Port_PinDesc[i].pin_Mask;
+			Port_RuntimeMask[port_Num][PORT_IMAGE_DIGITAL_ENABLE] |= Port_PinDesc[i].pin_Mask;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+		if((port_Num < PORT_NUMBER_OF_PORTS)
+				&& ((ConfigPtr->Pins[i].pin_Mode_Changeable == TRUE) || (ConfigPtr->Pins[i].pin_Mode != PORT_MODE_ANALOG)))
+		{
+			for(uint8 reg = PORT_IMAGE_PAD_FIRST; reg < PORT_IMAGE_REGS; reg++)
+			{
+				Port_RuntimeMask[port_Num][reg] |= Port_PinDesc[i].pin_Mask;
+			}
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+
+	/* CRC of the register images Port_VerifyConfiguration checks the registers against */
+	for(uint8 port_Num = 0; port_Num < PORT_NUMBER_OF_PORTS; port_Num++)
+	{
+		for(uint8 reg = 0; reg < PORT_IMAGE_REGS; reg++)
+		{
+			crc = Port_CrcWord(crc, ConfigPtr->Ports[port_Num].Regs[reg].mask);
+			crc = Port_CrcWord(crc, ConfigPtr->Ports[port_Num].Regs[reg].value);
+		}
+		crc = Port_CrcWord(crc, ConfigPtr->Ports[port_Num].commit_Mask);
+	}
+	Port_ConfigCrc = ~Port_CrcWord(crc, ((uint32)ConfigPtr->ahb_Mask << 8) | ConfigPtr->clock_Mask);
+
+	/* List the ports with refreshed pins once, so the refresh does not scan the ports without any */
+	Port_RefreshPortCount = 0;
+	Port_RefreshCursor = 0;
+	Port_SweepCount = 0;
+	for(uint8 port_Num = 0; port_Num < PORT_NUMBER_OF_PORTS; port_Num++)
+	{
+		if(Port_RefreshMask[port_Num] != 0)
+		{
+			Port_RefreshPorts[Port_RefreshPortCount] = port_Num;
+			Port_RefreshPortCount++;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+}
+
+/************************************************************************************
+ * Function Name: Port_SeedShadow
+ * Description: Reads the configuration registers of a newly clocked port into its shadow,
+ *              the only time they are read
+ ************************************************************************************/
+STATIC void Port_SeedShadow(uint8 port_Num)
+{
+	for(uint8 reg = PORT_IMAGE_CTL; reg < PORT_IMAGE_PAD_FIRST; reg++)
+	{
+		Port_Shadow[port_Num][reg] = PORT_REG_READ(Port_BaseAddress[port_Num] + Port_ImageRegOffset[reg]);
+	}
+	/* The pad registers are read by Port_SeedPad, when a pad setting is first programmed */
+	Port_PadShadowed &= (uint8)~(1U << port_Num);
+}
+
+/************************************************************************************
+ * Function Name: Port_ShadowDiff
+ * Description: Keeps only the configuration registers bits of a target image that differ
+ *              from the RAM shadow of the port, GPIODATA is left to the caller
+ ************************************************************************************/
+STATIC void Port_ShadowDiff(uint8 port_Num, const Port_PortImageType * Target, Port_PortImageType * Diff)
+{
+	Port_SeedPad(port_Num, Target);
+	for(uint8 reg = PORT_IMAGE_CTL; reg < PORT_IMAGE_REGS; reg++)
+	{
+		const Port_RegImageType * Reg = &Target->Regs[reg];
+		uint32 reg_Mask = Reg->mask & (Port_Shadow[port_Num][reg] ^ Reg->value);
+		Diff->Regs[reg].mask = reg_Mask;
+		Diff->Regs[reg].value = Reg->value & reg_Mask;
+	}
+}
+
+/************************************************************************************
+ * Function Name: Port_SnapshotShadow
+ * Description: Copies the RAM shadow of the configuration registers of a port into a snapshot
+ ************************************************************************************/
+STATIC void Port_SnapshotShadow(uint8 port_Num, Port_PortSnapshotType * Snapshot)
+{
+	const uint32 * Shadow = Port_Shadow[port_Num];
+
+	Snapshot->ctl = Shadow[PORT_IMAGE_CTL];
+	Snapshot->alt_Func = (uint8)Shadow[PORT_IMAGE_ALT_FUNC];
+	Snapshot->analog_Mode_Sel = (uint8)Shadow[PORT_IMAGE_ANALOG_MODE_SEL];
+	Snapshot->digital_Enable = (uint8)Shadow[PORT_IMAGE_DIGITAL_ENABLE];
+	Snapshot->pull_Up = (uint8)Shadow[PORT_IMAGE_PULL_UP];
+	Snapshot->pull_Down = (uint8)Shadow[PORT_IMAGE_PULL_DOWN];
+	Snapshot->dir = (uint8)Shadow[PORT_IMAGE_DIR];
+}
+
+/************************************************************************************
+ * Function Name: Port_DiffImage
+ * Description: Builds the register image that takes a port from its current registers
+ *              to a target image, with only the bits that differ. The configuration
+ *              registers are compared with the RAM shadow, GPIODATA with the levels
+ *              of the active image since the pin levels are not shadowed
+ ************************************************************************************/
+STATIC void Port_DiffImage(uint8 port_Num, const Port_PortImageType * Active, const Port_PortImageType * Target,
+		Port_PortImageType * Diff)
+{
+	const Port_RegImageType * Data = &Target->Regs[PORT_IMAGE_DATA];
+	uint32 data_Mask = Data->mask & ~(Active->Regs[PORT_IMAGE_DATA].mask & ~(Active->Regs[PORT_IMAGE_DATA].value ^ Data->value));
+
+	Diff->Regs[PORT_IMAGE_DATA].mask = data_Mask;
+	Diff->Regs[PORT_IMAGE_DATA].value = Data->value & data_Mask;
+	Port_ShadowDiff(port_Num, Target, Diff);
+	/* GPIOCR keeps the pins the active configuration already unlocked */
+	Diff->commit_Mask = Target->commit_Mask & ~Active->commit_Mask;
+}
+
+#if (PORT_TRACE == STD_ON)
+/************************************************************************************
+ * Function Name: Port_TraceRecord
+ * Description: Records one service call into the next slot of the trace ring buffer.
+ *              The slot is claimed with an atomic increment of the head, so tasks and
+ *              ISRs record concurrently without a lock, and its sequence is written last.
+ *              The stores counted since Stores_Begin include those of concurrent callers
+ ************************************************************************************/
+STATIC void Port_TraceRecord(uint8 ServiceId, uint8 Pin, uint16 Argument, uint32 Stores_Begin)
+{
+	uint32 stores = PORT_ATOMIC_LOAD(&Port_TraceStores) - Stores_Begin;
+	uint32 sequence = PORT_ATOMIC_FETCH_ADD(&Port_Trace.head, 1U);
+	Port_TraceRecordType * Record = &Port_Trace.records[sequence & (PORT_TRACE_RECORDS - 1U)];
+
+	Record->timestamp = PORT_TRACE_TIMESTAMP();
+	Record->argument = Argument;
+	Record->service_Id = ServiceId;
+	Record->pin = Pin;
+	Record->stores = (stores > 0xFFFFU) ? 0xFFFFU : (uint16)stores;
+	PORT_ATOMIC_STORE(&Record->sequence, (uint16)sequence);
+}
+#endif
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+/************************************************************************************
+ * Function Name: Port_PinModesSupported
+ * Description: Checks every pin of a configuration exists and is set to a mode it supports,
+ *              for the configurations not checked at build time by PORT_CHECK_PINS
+ ************************************************************************************/
+STATIC boolean Port_PinModesSupported(const Port_ConfigType * ConfigPtr)
+{
+	boolean supported = TRUE;
+
+	for(uint8 i = 0; i < PORT_CONFIGURED_PINS; i++)
+	{
+		uint8 port_Num = ConfigPtr->Pins[i].port_Num;
+		uint8 pin_Num = ConfigPtr->Pins[i].pin_Num;
+		uint8 pin_Mode = ConfigPtr->Pins[i].pin_Mode;
+
+		if((port_Num >= PORT_NUMBER_OF_PORTS) || (pin_Num >= PORT_PINS_PER_PORT) || (pin_Mode > PORT_MODE_ANALOG)
+				|| ((Port_PinModes[port_Num][pin_Num] & PORT_MODE_BIT(pin_Mode)) == 0U))
+		{
+			supported = FALSE;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+	return supported;
+}
+#endif
+
+/************************************************************************************
+ * Service Name: Port_Init
+ * Service ID[hex]: 0x00
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): ConfigPtr - Pointer to configuration set
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Initializes the Port Driver module
+ ************************************************************************************/
+void Port_Init(const Port_ConfigType* ConfigPtr)
+{
+	PORT_TRACE_BEGIN();
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if the input configuration pointer is not a NULL_PTR */
+	if (NULL_PTR == ConfigPtr)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID,
+				PORT_E_PARAM_CONFIG);
+	}
+	/* check if a pin of the configuration is set to a mode it does not support */
+	else if (Port_PinModesSupported(ConfigPtr) == FALSE)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID,
+				PORT_E_PARAM_CONFIG);
+	}
+	else
+#endif
+	{
+		Port_Status = PORT_INITIALIZED;
+		Port_UpdateOpen = FALSE;   /* An update left open is dropped by the new configuration */
+		Port_SafeState = FALSE;    /* So is a saved state, the registers are programmed again */
+
+#if (PORT_AHB_APERTURE == STD_ON)
+		/* Move the selected ports to the AHB aperture and the other ports back to the APB aperture */
+		PORT_REG_WRITE(SYSCTL_GPIOHBCTL_ADDRESS, (PORT_REG_READ(SYSCTL_GPIOHBCTL_ADDRESS) & ~(uint32)SYSCTL_GPIOHBCTL_PORTS_MASK)
+				| (ConfigPtr->ahb_Mask & SYSCTL_GPIOHBCTL_PORTS_MASK));
+#endif
+
+		for(uint8 port_Num = 0; port_Num < PORT_NUMBER_OF_PORTS; port_Num++)
+		{
+			Port_DriftCount[port_Num] = 0;
+		}
+		Port_LoadConfig(ConfigPtr);
+
+		/* Enable clock for all the used PORTs and wait for them to be ready */
+		Port_ClockOn = 0;
+		Port_ClockEnable(ConfigPtr->clock_Mask);
+
+		for(uint8 port_Num = 0; port_Num < PORT_NUMBER_OF_PORTS; port_Num++)
+		{
+			if(ConfigPtr->clock_Mask & (1U << port_Num))
+			{
+				Port_SeedShadow(port_Num);
+				Port_ProgramPort(port_Num, &ConfigPtr->Ports[port_Num]);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+#if (PORT_CLOCK_GATING == STD_ON)
+		/* The ports with analog or unused pins only do not need their clock */
+		Port_ClockGateIdle();
+#endif
+	}
+	PORT_TRACE_END(PORT_INIT_SID, PORT_TRACE_NO_PIN, 0);
+}
+
+/************************************************************************************
+ * Service Name: Port_SetPinDirection
+ * Service ID[hex]: 0x01
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): - Pin - Port Pin ID number
+ 	 	 	 	 	- Direction - Port Pin Direction
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Sets the port pin direction, only GPIODIR is written and the pin keeps
+ *              its output level and its internal resistor
+ ************************************************************************************/
+void Port_SetPinDirection(Port_PinType Pin, Port_PinDirection Direction)
+{
+	PORT_TRACE_BEGIN();
+	boolean error = FALSE;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if API service called prior to module initialization */
+	if(Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINDIRECTION_SID,
+				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if Incorrect Port Pin ID passed */
+	if (Pin >= PORT_CONFIGURED_PINS)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINDIRECTION_SID,
+				PORT_E_PARAM_PIN);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if Port Pin not configured as changeable, the configuration is only read for a valid pin */
+	if((error == FALSE) && (Port_Pins[Pin].pin_Direction_Changeable == FALSE))
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINDIRECTION_SID,
+				PORT_E_DIRECTION_UNCHANGEABLE);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	if(error == FALSE)
+	{
+		const Port_PinDescType * Pin_Desc = &Port_PinDesc[Pin];
+		uint32 dir_Value = (Direction == PORT_PIN_OUT) ? Pin_Desc->pin_Mask : 0;
+
+		/* Only GPIODIR changes, the pin keeps its output level and its internal resistor */
+		PORT_ENTER_EXCLUSIVE_AREA();
+		if(Port_UpdateOpen == TRUE)
+		{
+			/* Staged until Port_CommitUpdate */
+			Port_ImageWrite(&Port_StagedImage(Pin_Desc->port_Num)->Regs[PORT_IMAGE_DIR], Pin_Desc->pin_Mask, dir_Value);
+		}
+		else
+		{
+#if (PORT_CLOCK_GATING == STD_ON)
+			Port_ClockEnable((uint8)(1U << Pin_Desc->port_Num));
+#endif
+#if (PORT_BITBAND_ACCESS == STD_ON)
+			/* One alias store changes the bit of this pin only, the bus applies it atomically */
+			PORT_ATOMIC_AND(&Port_Shadow[Pin_Desc->port_Num][PORT_IMAGE_DIR], ~(uint32)Pin_Desc->pin_Mask);
+			PORT_ATOMIC_OR(&Port_Shadow[Pin_Desc->port_Num][PORT_IMAGE_DIR], dir_Value);
+			PORT_REG_WRITE(PORT_BITBAND_ALIAS_ADDRESS(Pin_Desc->base_Address + PORT_DIR_REG_OFFSET, Pin_Desc->pin_Num),
+					(Direction == PORT_PIN_OUT) ? 1U : 0U);
+#else
+			/* One store of the tracked direction of the whole port, GPIODIR is not read back
+			 * unless PORT_ATOMIC_ACCESS makes it a load-exclusive/store-exclusive pair */
+			Port_ModifyReg(Pin_Desc->port_Num, PORT_IMAGE_DIR, Pin_Desc->pin_Mask, dir_Value);
+#endif
+		}
+		PORT_EXIT_EXCLUSIVE_AREA();
+	}
+	PORT_TRACE_END(PORT_SETPINDIRECTION_SID, Pin, Direction);
+}
+
+/************************************************************************************
+ * Service Name: Port_RefreshPortDirection
+ * Service ID[hex]: 0x02
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Refreshes the direction of the pins configured with an unchangeable
+ *              direction. Each call services the next PORT_REFRESH_PORTS_PER_CALL ports
+ *              with such pins in round robin, so every port is refreshed at least once
+ *              every ceil(ports / PORT_REFRESH_PORTS_PER_CALL) calls. GPIODIR of a
+ *              serviced port is read once and only written back when one of its
+ *              refreshed pins drifted from its configured direction
+ ************************************************************************************/
+void Port_RefreshPortDirection(void)
+{
+	PORT_TRACE_BEGIN();
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if API service called prior to module initialization */
+	if(Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_REFRESHPORTDIRECTION_SID,
+				PORT_E_UNINIT);
+	}
+	else
+#endif
+	if(Port_SafeState == FALSE)
+	{
+		for(uint8 i = 0; (i < PORT_REFRESH_PORTS_PER_CALL) && (i < Port_RefreshPortCount); i++)
+		{
+			Port_RefreshPort(Port_RefreshPorts[Port_RefreshCursor]);
+
+			Port_RefreshCursor++;
+			if(Port_RefreshCursor == Port_RefreshPortCount)
+			{
+				/* Every port with refreshed pins has been serviced since the last wrap */
+				Port_RefreshCursor = 0;
+				Port_SweepCount++;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+	else
+	{
+		/* The pins keep their safe direction until Port_RestoreState */
+	}
+	PORT_TRACE_END(PORT_REFRESHPORTDIRECTION_SID, PORT_TRACE_NO_PIN, 0);
+}
+
+/************************************************************************************
+ * Service Name: Port_GetVersionInfo
+ * Service ID[hex]: 0x03
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): versioninfo - Pointer to where to store the version information of this module
+ * Return value: None
+ * Description: Returns the version information of this module
+ ************************************************************************************/
+#if (PORT_VERSION_INFO_API == STD_ON)
+void Port_GetVersionInfo(Std_VersionInfoType *versioninfo)
+{
+	boolean error = FALSE;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if API service called prior to module initialization */
+	if(Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GETVERSIONINFO_SID,
+				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	if(NULL_PTR == versioninfo)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GETVERSIONINFO_SID,
+				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+	if(error == FALSE)
+	{
+		/* Copy the vendor Id */
+		versioninfo->vendorID = (uint16)PORT_VENDOR_ID;
+		/* Copy the module Id */
+		versioninfo->moduleID = (uint16)PORT_MODULE_ID;
+		/* Copy Software Major Version */
+		versioninfo->sw_major_version = (uint8)PORT_SW_MAJOR_VERSION;
+		/* Copy Software Minor Version */
+		versioninfo->sw_minor_version = (uint8)PORT_SW_MINOR_VERSION;
+		/* Copy Software Patch Version */
+		versioninfo->sw_patch_version = (uint8)PORT_SW_PATCH_VERSION;
+	}
+}
+#endif
+
+/************************************************************************************
+ * Service Name: Port_SetPinMode
+ * Service ID[hex]: 0x04
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): - Pin - Port Pin ID number
+ * 					- Mode - New Port Pin mode to be set on port pin
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Sets the requested port pin mode, writing only the registers whose bits
+ *              change, each from its RAM shadow, or bit by bit through the bit-band alias
+ *              when it is enabled
+ ************************************************************************************/
+void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
+{
+	PORT_TRACE_BEGIN();
+	boolean error = FALSE;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if API service called prior to module initialization */
+	if(Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINMODE_SID,
+				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if Incorrect Port Pin ID passed */
+	if (Pin >= PORT_CONFIGURED_PINS)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINMODE_SID,
+				PORT_E_PARAM_PIN);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if Port Pin not configured as changeable, the configuration is only read for a valid pin */
+	if((error == FALSE) && (Port_Pins[Pin].pin_Mode_Changeable == FALSE))
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINMODE_SID,
+				PORT_E_MODE_UNCHANGEABLE);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if Port Pin Mode passed not valid */
+	if(Mode > NO_MODES)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINMODE_SID,
+				PORT_E_PARAM_INVALID_MODE);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if the Port Pin does not support the mode, the pin is only looked up once it is valid */
+	if((error == FALSE) && (PORT_PIN_SUPPORTS_MODE(Pin, Mode) == FALSE))
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINMODE_SID,
+				PORT_E_PARAM_INVALID_MODE);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+	if(error == FALSE)
+	{
+		const Port_PinDescType * Pin_Desc = &Port_PinDesc[Pin];
+
+		/* Setup Pin Mode */
+		PORT_ENTER_EXCLUSIVE_AREA();
+		if(Port_UpdateOpen == TRUE)
+		{
+			/* Staged until Port_CommitUpdate */
+			Port_PinChangeType Change = {Pin, PORT_CHANGE_MODE, PORT_PIN_IN, Mode};
+			Port_FoldChange(Port_StagedImage(Pin_Desc->port_Num), Pin_Desc, &Change);
+		}
+		else
+		{
+			/* The requested mode with the same register bits as the staged path */
+			Port_PortImageType Image = {0};
+			Port_PinChangeType Change = {Pin, PORT_CHANGE_MODE, PORT_PIN_IN, Mode};
+			Port_FoldChange(&Image, Pin_Desc, &Change);
+#if (PORT_CLOCK_GATING == STD_ON)
+			Port_ClockEnable((uint8)(1U << Pin_Desc->port_Num));
+#endif
+			/* Only the registers whose bits differ from the shadow, which holds the live mode of the pin,
+			 * are written in the Port_Init order. Usually GPIOAFSEL and the PMCx bits of GPIOPCTL */
+			for(uint8 reg = PORT_IMAGE_CTL; reg < PORT_IMAGE_PAD_FIRST; reg++)
+			{
+				uint32 reg_Mask = Image.Regs[reg].mask & (PORT_ATOMIC_LOAD(&Port_Shadow[Pin_Desc->port_Num][reg]) ^ Image.Regs[reg].value);
+				if(reg_Mask != 0)
+				{
+					Port_ModifyReg(Pin_Desc->port_Num, reg, reg_Mask, Image.Regs[reg].value & reg_Mask);
+				}
+				else
+				{
+					/* No Action Required */
+				}
+			}
+#if ((PORT_CLOCK_GATING == STD_ON) && (PORT_ATOMIC_ACCESS == STD_OFF))
+			/* An analog pin may have been the last digital pin of its port. With PORT_ATOMIC_ACCESS a
+			 * concurrent caller may be about to access the port, it is gated by the next non reentrant service */
+			Port_ClockGateIdle();
+#endif
+		}
+		PORT_EXIT_EXCLUSIVE_AREA();
+	}
+	PORT_TRACE_END(PORT_SETPINMODE_SID, Pin, Mode);
+}
+
+/************************************************************************************
+ * Service Name: Port_WritePin
+ * Service ID[hex]: 0x05
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): - Pin - Port Pin ID number
+ * 					- Level - STD_HIGH or STD_LOW
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Writes the level of one port pin with a single store to its masked
+ *              GPIODATA address, the other pins of the port are not affected
+ ************************************************************************************/
+void Port_WritePin(Port_PinType Pin, uint8 Level)
+{
+	PORT_TRACE_BEGIN();
+	boolean error = FALSE;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if API service called prior to module initialization */
+	if(Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_WRITEPIN_SID,
+				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if Incorrect Port Pin ID passed */
+	if (Pin >= PORT_CONFIGURED_PINS)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_WRITEPIN_SID,
+				PORT_E_PARAM_PIN);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+	if(error == FALSE)
+	{
+		const Port_PinDescType * Pin_Desc = &Port_PinDesc[Pin];
+		if(Port_UpdateOpen == TRUE)
+		{
+			/* Staged until Port_CommitUpdate */
+			PORT_ENTER_EXCLUSIVE_AREA();
+			Port_ImageWrite(&Port_StagedImage(Pin_Desc->port_Num)->Regs[PORT_IMAGE_DATA], Pin_Desc->pin_Mask,
+					(Level == STD_HIGH) ? Pin_Desc->pin_Mask : 0);
+			PORT_EXIT_EXCLUSIVE_AREA();
+		}
+		else
+		{
+#if (PORT_CLOCK_GATING == STD_ON)
+			Port_ClockEnable((uint8)(1U << Pin_Desc->port_Num));
+#endif
+			PORT_REG_WRITE(Pin_Desc->base_Address + PORT_DATA_MASKED_OFFSET(Pin_Desc->pin_Mask),
+					(Level == STD_HIGH) ? Pin_Desc->pin_Mask : 0);
+		}
+	}
+	PORT_TRACE_END(PORT_WRITEPIN_SID, Pin, Level);
+}
+
+/************************************************************************************
+ * Service Name: Port_WritePort
+ * Service ID[hex]: 0x06
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): - Port - Port ID number
+ * 					- Mask - Pins of the port to be written
+ * 					- Levels - New levels of the masked pins, one bit per pin
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Writes the levels of any subset of the pins of one port with a single
+ *              store to the masked GPIODATA address, the other pins are not affected
+ ************************************************************************************/
+void Port_WritePort(Port_PortType Port, uint8 Mask, uint8 Levels)
+{
+	PORT_TRACE_BEGIN();
+	boolean error = FALSE;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if API service called prior to module initialization */
+	if(Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_WRITEPORT_SID,
+				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if Incorrect Port ID passed */
+	if (Port >= PORT_NUMBER_OF_PORTS)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_WRITEPORT_SID,
+				PORT_E_PARAM_PORT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+	if(error == FALSE)
+	{
+		if(Port_UpdateOpen == TRUE)
+		{
+			/* Staged until Port_CommitUpdate */
+			PORT_ENTER_EXCLUSIVE_AREA();
+			Port_ImageWrite(&Port_StagedImage(Port)->Regs[PORT_IMAGE_DATA], Mask, Levels);
+			PORT_EXIT_EXCLUSIVE_AREA();
+		}
+		else
+		{
+#if (PORT_CLOCK_GATING == STD_ON)
+			Port_ClockEnable((uint8)(1U << Port));
+#endif
+			PORT_REG_WRITE(Port_BaseAddress[Port] + PORT_DATA_MASKED_OFFSET(Mask), Levels);
+		}
+	}
+	PORT_TRACE_END(PORT_WRITEPORT_SID, Port, ((uint16)Mask << 8) | Levels);
+}
+
+/************************************************************************************
+ * Service Name: Port_SetPinGroup
+ * Service ID[hex]: 0x07
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): - Changes - Array of the pin direction and/or mode changes
+ * 					- NumberOfChanges - Number of entries in Changes
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Changes the direction and/or mode of a group of pins. All the changes are
+ *              validated before any register is written, then they are grouped by port
+ *              and every affected register of a port is written once
+ ************************************************************************************/
+void Port_SetPinGroup(const Port_PinChangeType * Changes, uint8 NumberOfChanges)
+{
+	PORT_TRACE_BEGIN();
+	boolean error = FALSE;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if API service called prior to module initialization */
+	if(Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINGROUP_SID,
+				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if the input changes pointer is not a NULL_PTR */
+	if(NULL_PTR == Changes)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINGROUP_SID,
+				PORT_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	else if(error == FALSE)
+	{
+		/* The configuration of the pins is only read once the driver is initialized */
+		for(uint8 i = 0; i < NumberOfChanges; i++)
+		{
+			const Port_PinChangeType * Change = &Changes[i];
+			/* check if Incorrect Port Pin ID passed */
+			if(Change->pin >= PORT_CONFIGURED_PINS)
+			{
+				Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINGROUP_SID,
+						PORT_E_PARAM_PIN);
+				error = TRUE;
+			}
+			/* check if Port Pin direction not configured as changeable */
+			else if((Change->change_Mask & PORT_CHANGE_DIRECTION) && (Port_Pins[Change->pin].pin_Direction_Changeable == FALSE))
+			{
+				Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINGROUP_SID,
+						PORT_E_DIRECTION_UNCHANGEABLE);
+				error = TRUE;
+			}
+			/* check if Port Pin mode not configured as changeable */
+			else if((Change->change_Mask & PORT_CHANGE_MODE) && (Port_Pins[Change->pin].pin_Mode_Changeable == FALSE))
+			{
+				Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINGROUP_SID,
+						PORT_E_MODE_UNCHANGEABLE);
+				error = TRUE;
+			}
+			/* check if Port Pin Mode passed not valid */
+			else if((Change->change_Mask & PORT_CHANGE_MODE) && (Change->pin_Mode > PORT_MODE_ANALOG))
+			{
+				Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINGROUP_SID,
+						PORT_E_PARAM_INVALID_MODE);
+				error = TRUE;
+			}
+			/* check if the Port Pin does not support the mode */
+			else if((Change->change_Mask & PORT_CHANGE_MODE) && (PORT_PIN_SUPPORTS_MODE(Change->pin, Change->pin_Mode) == FALSE))
+			{
+				Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINGROUP_SID,
+						PORT_E_PARAM_INVALID_MODE);
+				error = TRUE;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+	if(error == FALSE)
+	{
+		for(uint8 port_Num = 0; port_Num < PORT_NUMBER_OF_PORTS; port_Num++)
+		{
+			Port_PortImageType Image = {0};
+			boolean port_Changed = FALSE;
+
+			/* Fold every change of this port into one register image, or into the staged image while an update is open */
+			for(uint8 i = 0; i < NumberOfChanges; i++)
+			{
+				const Port_PinDescType * Pin_Desc = &Port_PinDesc[Changes[i].pin];
+				if(Pin_Desc->port_Num == port_Num)
+				{
+					Port_FoldChange((Port_UpdateOpen == TRUE) ? Port_StagedImage(port_Num) : &Image, Pin_Desc, &Changes[i]);
+					port_Changed = TRUE;
+				}
+				else
+				{
+					/* No Action Required */
+				}
+			}
+
+			if((port_Changed == TRUE) && (Port_UpdateOpen == FALSE))
+			{
+				Port_ProgramPort(port_Num, &Image);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+#if (PORT_CLOCK_GATING == STD_ON)
+		Port_ClockGateIdle();
+#endif
+	}
+	PORT_TRACE_END(PORT_SETPINGROUP_SID, PORT_TRACE_NO_PIN, NumberOfChanges);
+}
+
+/************************************************************************************
+ * Service Name: Port_BeginUpdate
+ * Service ID[hex]: 0x08
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Opens an update. Until Port_CommitUpdate, Port_SetPinDirection,
+ *              Port_SetPinMode, Port_SetPinGroup, Port_WritePin and Port_WritePort
+ *              stage their changes in RAM instead of writing the registers
+ ************************************************************************************/
+void Port_BeginUpdate(void)
+{
+	PORT_TRACE_BEGIN();
+	boolean error = FALSE;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if API service called prior to module initialization */
+	if(Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_BEGINUPDATE_SID,
+				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if an update is already open */
+	if(Port_UpdateOpen == TRUE)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_BEGINUPDATE_SID,
+				PORT_E_UPDATE_STATE);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+	if(error == FALSE)
+	{
+		Port_PortImageType Empty = {0};
+
+		for(uint8 port_Num = 0; port_Num < PORT_NUMBER_OF_PORTS; port_Num++)
+		{
+			Port_Staged[port_Num] = Empty;
+		}
+		Port_StagedPorts = 0;
+		Port_UpdateOpen = TRUE;
+	}
+	PORT_TRACE_END(PORT_BEGINUPDATE_SID, PORT_TRACE_NO_PIN, 0);
+}
+
 /************************************************************************************
- * Service Name: Port_Init
- * Service ID[hex]: 0x00
+ * Service Name: Port_CommitUpdate
+ * Service ID[hex]: 0x09
  * Sync/Async: Synchronous
  * Reentrancy: Non Reentrant
- * Parameters (in): ConfigPtr - Pointer to configuration set
+ * Parameters (in): None
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Initializes the Port Driver module
+ * Description: Writes the changes staged since Port_BeginUpdate and closes the update.
+ *              Only the registers with staged bits are written, once per port, in the
+ *              port image order: GPIODATA before GPIODIR and GPIOPCTL before GPIOAFSEL,
+ *              so an output is driven at its new level and a pin is routed to its new
+ *              peripheral before the pin switches over
  ************************************************************************************/
-void Port_Init(const Port_ConfigType* ConfigPtr)
+void Port_CommitUpdate(void)
 {
+	PORT_TRACE_BEGIN();
+	boolean error = FALSE;
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
-	/* check if the input configuration pointer is not a NULL_PTR */
-	if (NULL_PTR == ConfigPtr)
+	/* check if API service called prior to module initialization */
+	if(Port_Status == PORT_NOT_INITIALIZED)
 	{
-		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID,
-				PORT_E_PARAM_CONFIG);
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_COMMITUPDATE_SID,
+				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if no update is open */
+	if(Port_UpdateOpen == FALSE)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_COMMITUPDATE_SID,
+				PORT_E_UPDATE_STATE);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+	if(error == FALSE)
+	{
+		Port_UpdateOpen = FALSE;
+		for(uint8 port_Num = 0; port_Num < PORT_NUMBER_OF_PORTS; port_Num++)
+		{
+			if(Port_StagedPorts & (1U << port_Num))
+			{
+				Port_ProgramPort(port_Num, &Port_Staged[port_Num]);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+		Port_StagedPorts = 0;
+#if (PORT_CLOCK_GATING == STD_ON)
+		Port_ClockGateIdle();
+#endif
+	}
+	PORT_TRACE_END(PORT_COMMITUPDATE_SID, PORT_TRACE_NO_PIN, 0);
+}
+
+/************************************************************************************
+ * Service Name: Port_GetPinDirection
+ * Service ID[hex]: 0x0A
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Pin - Port Pin ID number
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Port_PinDirection - Current direction of the pin
+ * Description: Returns the current direction of a port pin from the RAM shadow, without
+ *              any peripheral access. Changes staged by an open update are not included
+ ************************************************************************************/
+Port_PinDirection Port_GetPinDirection(Port_PinType Pin)
+{
+	boolean error = FALSE;
+	Port_PinDirection Direction = PORT_PIN_IN;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if API service called prior to module initialization */
+	if(Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GETPINDIRECTION_SID,
+				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if Incorrect Port Pin ID passed */
+	if (Pin >= PORT_CONFIGURED_PINS)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GETPINDIRECTION_SID,
+				PORT_E_PARAM_PIN);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+	if(error == FALSE)
+	{
+		const Port_PinDescType * Pin_Desc = &Port_PinDesc[Pin];
+		Direction = (Port_Shadow[Pin_Desc->port_Num][PORT_IMAGE_DIR] & Pin_Desc->pin_Mask) ? PORT_PIN_OUT : PORT_PIN_IN;
+	}
+	return Direction;
+}
+
+/************************************************************************************
+ * Service Name: Port_GetPinMode
+ * Service ID[hex]: 0x0B
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Pin - Port Pin ID number
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Port_PinModeType - Current mode of the pin
+ * Description: Returns the current mode of a port pin decoded from the RAM shadow of
+ *              GPIOAMSEL, GPIOAFSEL and GPIOPCTL, without any peripheral access.
+ *              Changes staged by an open update are not included
+ ************************************************************************************/
+Port_PinModeType Port_GetPinMode(Port_PinType Pin)
+{
+	boolean error = FALSE;
+	Port_PinModeType Mode = PORT_MODE_DIO;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if API service called prior to module initialization */
+	if(Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GETPINMODE_SID,
+				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if Incorrect Port Pin ID passed */
+	if (Pin >= PORT_CONFIGURED_PINS)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GETPINMODE_SID,
+				PORT_E_PARAM_PIN);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+	if(error == FALSE)
+	{
+		const Port_PinDescType * Pin_Desc = &Port_PinDesc[Pin];
+		const uint32 * Shadow = Port_Shadow[Pin_Desc->port_Num];
+
+		if(Shadow[PORT_IMAGE_ANALOG_MODE_SEL] & Pin_Desc->pin_Mask)
+		{
+			Mode = PORT_MODE_ANALOG;
+		}
+		else if(Shadow[PORT_IMAGE_ALT_FUNC] & Pin_Desc->pin_Mask)
+		{
+			Mode = (Port_PinModeType)((Shadow[PORT_IMAGE_CTL] >> Pin_Desc->ctl_Shift) & 0x0000000F);
+		}
+		else
+		{
+			Mode = PORT_MODE_DIO;
+		}
+	}
+	return Mode;
+}
+
+/************************************************************************************
+ * Service Name: Port_GetPortSnapshot
+ * Service ID[hex]: 0x0C
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port - Port ID number
+ * Parameters (inout): None
+ * Parameters (out): Snapshot - Pointer to where to store the configuration registers of the port
+ * Return value: None
+ * Description: Copies the current configuration registers of a port from the RAM shadow,
+ *              without any peripheral access. Changes staged by an open update are not included
+ ************************************************************************************/
+void Port_GetPortSnapshot(Port_PortType Port, Port_PortSnapshotType * Snapshot)
+{
+	boolean error = FALSE;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if API service called prior to module initialization */
+	if(Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GETPORTSNAPSHOT_SID,
+				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if Incorrect Port ID passed */
+	if (Port >= PORT_NUMBER_OF_PORTS)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GETPORTSNAPSHOT_SID,
+				PORT_E_PARAM_PORT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if the output snapshot pointer is not a NULL_PTR */
+	if(NULL_PTR == Snapshot)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GETPORTSNAPSHOT_SID,
+				PORT_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+	if(error == FALSE)
+	{
+		Port_SnapshotShadow(Port, Snapshot);
+	}
+}
+
+/************************************************************************************
+ * Service Name: Port_GetDriftCount
+ * Service ID[hex]: 0x0D
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port - Port ID number
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Number of refreshes that repaired the port since Port_Init
+ * Description: Returns the number of times Port_RefreshPortDirection found a pin of the
+ *              port with an unchangeable direction drifted and wrote GPIODIR back
+ ************************************************************************************/
+uint32 Port_GetDriftCount(Port_PortType Port)
+{
+	boolean error = FALSE;
+	uint32 Count = 0;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if API service called prior to module initialization */
+	if(Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GETDRIFTCOUNT_SID,
+				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if Incorrect Port ID passed */
+	if (Port >= PORT_NUMBER_OF_PORTS)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GETDRIFTCOUNT_SID,
+				PORT_E_PARAM_PORT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+	if(error == FALSE)
+	{
+		Count = Port_DriftCount[Port];
+	}
+	return Count;
+}
+
+/************************************************************************************
+ * Service Name: Port_GetSweepCount
+ * Service ID[hex]: 0x0E
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Number of completed refresh sweeps since Port_Init
+ * Description: Returns the number of times Port_RefreshPortDirection serviced every port
+ *              with refreshed pins, one sweep spans several calls when the refresh is sliced
+ ************************************************************************************/
+uint32 Port_GetSweepCount(void)
+{
+	boolean error = FALSE;
+	uint32 Count = 0;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if API service called prior to module initialization */
+	if(Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GETSWEEPCOUNT_SID,
+				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+	if(error == FALSE)
+	{
+		Count = Port_SweepCount;
+	}
+	return Count;
+}
+
+/************************************************************************************
+ * Service Name: Port_VerifyConfiguration
+ * Service ID[hex]: 0x0F
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): Result - Pointer to where to store the mismatching registers and the configuration CRC
+ * Return value: Std_ReturnType - E_OK when every checked register matches, E_NOT_OK otherwise
+ * Description: Reads every configuration register of the used ports once and compares
+ *              the bits of the configured pins (the care mask of the register image)
+ *              with the configured register image, overlaid by the safe state image while
+ *              the port is in the safe state. Only the bits the changeable services may
+ *              change at runtime (the direction and mode of the changeable pins, and the
+ *              pad settings) are expected as the RAM shadow holds them, so a corrupted
+ *              shadow or a stray write is reported. GPIODATA holds pin levels and is not checked
+ ************************************************************************************/
+Std_ReturnType Port_VerifyConfiguration(Port_VerifyResultType * Result)
+{
+	boolean error = FALSE;
+	Std_ReturnType Status = E_NOT_OK;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if API service called prior to module initialization */
+	if(Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_VERIFYCONFIGURATION_SID,
+				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if the output result pointer is not a NULL_PTR */
+	if(NULL_PTR == Result)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_VERIFYCONFIGURATION_SID,
+				PORT_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
 	}
-	else
 #endif
+	if(error == FALSE)
 	{
-		Port_Pins = ConfigPtr->Pins;
-		Port_Status = PORT_INITIALIZED;
-		volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-		volatile uint32 delay = 0;
-		for(uint8 i = 0; i < PORT_CONFIGURED_PINS; i++)
+		uint8 read_Ports = Port_ClockMask;
+
+#if (PORT_CLOCK_GATING == STD_ON)
+		/* The registers of a gated port can not be read, they are kept unchanged while it is gated */
+		read_Ports &= Port_ClockOn;
+#endif
+		Status = E_OK;
+		for(uint8 port_Num = 0; port_Num < PORT_NUMBER_OF_PORTS; port_Num++)
 		{
-			uint8 port_Num = ConfigPtr->Pins[i].port_Num;
-			uint8 pin_Num = ConfigPtr->Pins[i].pin_Num;
-			uint8 pin_Direction = ConfigPtr->Pins[i].pin_Direction;
-			uint8 internal_Resistor = ConfigPtr->Pins[i].internal_Resistor;
-			uint8 pin_Init_Value = ConfigPtr->Pins[i].pin_Init_Value;
-			uint8 pin_Mode = ConfigPtr->Pins[i].pin_Mode;
-			switch(port_Num)
-			{
-			case  PORTA: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-			break;
-			case  PORTB: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-			break;
-			case  PORTC: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-			break;
-			case  PORTD: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-			break;
-			case  PORTE: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-			break;
-			case  PORTF: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-			break;
-			default: break;
-			}
-			if(PortGpio_Ptr == NULL_PTR)
-			{
-				continue;
-			}
-			/* Enable clock for PORT and allow time for clock to start*/
-			SYSCTL_REGCGC2_REG |= (1<<port_Num);
-			delay = SYSCTL_REGCGC2_REG;
+			uint16 mismatch_Mask = 0;
 
-			if( ((port_Num == PORTD) && (pin_Num == 7)) || ((port_Num == PORTF) && (pin_Num == 0)) ) /* PD7 or PF0 */
-			{
-				*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;                     /* Unlock the GPIOCR register */
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET) , pin_Num);  /* Set the corresponding bit in GPIOCR register to allow changes on this pin */
-			}
-			else if( (port_Num == PORTC) && (pin_Num <= 3) ) /* PC0 to PC3 */
-			{
-				/* Do Nothing ...  this is the JTAG pins */
-			}
-			else
+			if(read_Ports & (1U << port_Num))
 			{
-				/* Do Nothing ... No need to unlock the commit register for this pin */
-			}
+				for(uint8 reg = PORT_IMAGE_CTL; reg < PORT_IMAGE_REGS; reg++)
+				{
+					uint32 care_Mask = Port_Images[port_Num].Regs[reg].mask;
+					uint32 expected_Value = Port_Images[port_Num].Regs[reg].value;
+					uint32 runtime_Mask = Port_RuntimeMask[port_Num][reg];
 
-			/* Setup Pin Mode */
-			if(pin_Mode == PORT_MODE_DIO)
-			{
-				CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , pin_Num);      /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-				CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , pin_Num);             /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-				*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (pin_Num * 4));     /* Clear the PMCx bits for this pin */
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , pin_Num);        /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-			}
-			else if(pin_Mode == PORT_MODE_ANALOG)
-			{
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , pin_Num);      /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-				CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , pin_Num);        /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
+					if(Port_SafeState == TRUE)
+					{
+						/* The pins of the safe state image are held at it, none of them is changed at runtime */
+						const Port_RegImageType * Safe = &Port_SafeImages[port_Num].Regs[reg];
+						care_Mask |= Safe->mask;
+						expected_Value = (expected_Value & ~Safe->mask) | Safe->value;
+						runtime_Mask &= ~Safe->mask;
+					}
+					else
+					{
+						/* No Action Required */
+					}
+					expected_Value = (expected_Value & ~runtime_Mask) | (Port_Shadow[port_Num][reg] & runtime_Mask);
+					if((care_Mask != 0)
+							&& (((PORT_REG_READ(Port_BaseAddress[port_Num] + Port_ImageRegOffset[reg]) ^ expected_Value) & care_Mask) != 0))
+					{
+						mismatch_Mask |= (uint16)(1U << reg);
+					}
+					else
+					{
+						/* No Action Required */
+					}
+				}
 			}
 			else
 			{
-				CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , pin_Num);          /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , pin_Num);                   /* enable Alternative function for this pin */
-				*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (pin_Num * 4));         /* Clear the PMCx bits for this pin */
-				*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (pin_Mode << (pin_Num * 4));      	  /* Set the PMCx bits for this pin to the selected Alternate function in the configurations */
+				/* No Action Required */
 			}
 
-			/* Setup Pin Direction */
-			if(pin_Direction == PORT_PIN_OUT)
-			{
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , pin_Num);                /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-
-				if(pin_Init_Value == STD_HIGH)
-				{
-					SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) , pin_Num);          /* Set the corresponding bit in the GPIODATA register to provide initial value 1 */
-				}
-				else
-				{
-					CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) , pin_Num);        /* Clear the corresponding bit in the GPIODATA register to provide initial value 0 */
-				}
-			}
-			else if(pin_Direction == PORT_PIN_IN)
+			Result->mismatch_Mask[port_Num] = mismatch_Mask;
+			if(mismatch_Mask != 0)
 			{
-				CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , pin_Num);             /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-
-				if(internal_Resistor == PORT_PIN_PULL_UP)
-				{
-					SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , pin_Num);       /* Set the corresponding bit in the GPIOPUR register to enable the internal pull up pin */
-				}
-				else if(internal_Resistor == PORT_PIN_PULL_DOWN)
-				{
-					SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , pin_Num);     /* Set the corresponding bit in the GPIOPDR register to enable the internal pull down pin */
-				}
-				else
-				{
-					CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , pin_Num);     /* Clear the corresponding bit in the GPIOPUR register to disable the internal pull up pin */
-					CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , pin_Num);   /* Clear the corresponding bit in the GPIOPDR register to disable the internal pull down pin */
-				}
+				Status = E_NOT_OK;
 			}
 			else
 			{
-				/* Do Nothing */
+				/* No Action Required */
 			}
 		}
+		Result->config_Crc = Port_ConfigCrc;
 	}
+	return Status;
 }
 
-
 /************************************************************************************
- * Service Name: Port_SetPinDirection
- * Service ID[hex]: 0x01
+ * Service Name: Port_SwitchConfiguration
+ * Service ID[hex]: 0x10
  * Sync/Async: Synchronous
- * Reentrancy: Reentrant
- * Parameters (in): - Pin - Port Pin ID number
- 	 	 	 	 	- Direction - Port Pin Direction
+ * Reentrancy: Non Reentrant
+ * Parameters (in): ConfigPtr - Pointer to the configuration set to switch to
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Sets the port pin direction
+ * Description: Makes another configuration set the active one, writing only the registers
+ *              and bits where the target set differs from the current registers. Ports
+ *              used by the target set only are clocked and fully programmed, ports used
+ *              by the active set only keep their configuration and their clock
  ************************************************************************************/
-void Port_SetPinDirection(Port_PinType Pin, Port_PinDirection Direction)
+void Port_SwitchConfiguration(const Port_ConfigType * ConfigPtr)
 {
+	PORT_TRACE_BEGIN();
 	boolean error = FALSE;
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 	/* check if API service called prior to module initialization */
 	if(Port_Status == PORT_NOT_INITIALIZED)
 	{
-		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINDIRECTION_SID,
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SWITCHCONFIGURATION_SID,
 				PORT_E_UNINIT);
 		error = TRUE;
 	}
@@ -189,22 +1982,44 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirection Direction)
 	{
 		/* No Action Required */
 	}
-	/* check if Incorrect Port Pin ID passed */
-	if (Pin >= PORT_CONFIGURED_PINS)
+	/* check if the input configuration pointer is not a NULL_PTR */
+	if(NULL_PTR == ConfigPtr)
 	{
-		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINDIRECTION_SID,
-				PORT_E_PARAM_PIN);
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SWITCHCONFIGURATION_SID,
+				PORT_E_PARAM_CONFIG);
 		error = TRUE;
 	}
 	else
 	{
 		/* No Action Required */
 	}
-	/* check if Port Pin not configured as changeable */
-	if(Port_Pins[Pin].pin_Direction_Changeable == FALSE)
+	/* check if a pin of the configuration is set to a mode it does not support */
+	if((NULL_PTR != ConfigPtr) && (Port_PinModesSupported(ConfigPtr) == FALSE))
 	{
-		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINDIRECTION_SID,
-				PORT_E_DIRECTION_UNCHANGEABLE);
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SWITCHCONFIGURATION_SID,
+				PORT_E_PARAM_CONFIG);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if an update is open, its staged changes were made against the active set */
+	if(Port_UpdateOpen == TRUE)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SWITCHCONFIGURATION_SID,
+				PORT_E_UPDATE_STATE);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if the pins are in their safe state, the saved registers belong to the active set */
+	if(Port_SafeState == TRUE)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SWITCHCONFIGURATION_SID,
+				PORT_E_SAFE_STATE);
 		error = TRUE;
 	}
 	else
@@ -212,161 +2027,253 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirection Direction)
 		/* No Action Required */
 	}
 #endif
-
 	if(error == FALSE)
 	{
-		volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-		uint8 port_Num = Port_Pins[Pin].port_Num;
-		uint8 pin_Num = Port_Pins[Pin].pin_Num;
-		uint8 pin_Direction = Port_Pins[Pin].pin_Direction;
-		uint8 internal_Resistor = Port_Pins[Pin].internal_Resistor;
-		uint8 pin_Init_Value = Port_Pins[Pin].pin_Init_Value;
-		switch(port_Num)
+		const Port_PortImageType * Active = Port_Images;
+		uint8 new_Ports = ConfigPtr->clock_Mask & (uint8)~Port_ClockMask;
+
+#if (PORT_AHB_APERTURE == STD_ON)
+		if(ConfigPtr->ahb_Mask != Port_AhbMask)
 		{
-		case  PORTA: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-		break;
-		case  PORTB: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-		break;
-		case  PORTC: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-		break;
-		case  PORTD: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-		break;
-		case  PORTE: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-		break;
-		case  PORTF: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-		break;
-		default: break;
+			PORT_REG_WRITE(SYSCTL_GPIOHBCTL_ADDRESS, (PORT_REG_READ(SYSCTL_GPIOHBCTL_ADDRESS) & ~(uint32)SYSCTL_GPIOHBCTL_PORTS_MASK)
+					| (ConfigPtr->ahb_Mask & SYSCTL_GPIOHBCTL_PORTS_MASK));
 		}
-		if(PortGpio_Ptr == NULL_PTR)
+		else
 		{
-			return;
+			/* No Action Required */
 		}
-		/* Setup Pin Direction */
-		if(pin_Direction == PORT_PIN_OUT)
-		{
-			SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , pin_Num);                /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
+#endif
+		Port_LoadConfig(ConfigPtr);
+		Port_ClockEnable(new_Ports);
 
-			if(pin_Init_Value == STD_HIGH)
-			{
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) , pin_Num);          /* Set the corresponding bit in the GPIODATA register to provide initial value 1 */
-			}
-			else
-			{
-				CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET) , pin_Num);        /* Clear the corresponding bit in the GPIODATA register to provide initial value 0 */
-			}
-		}
-		else if(pin_Direction == PORT_PIN_IN)
+		for(uint8 port_Num = 0; port_Num < PORT_NUMBER_OF_PORTS; port_Num++)
 		{
-			CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , pin_Num);             /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-
-			if(internal_Resistor == PORT_PIN_PULL_UP)
+			if(new_Ports & (1U << port_Num))
 			{
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , pin_Num);       /* Set the corresponding bit in the GPIOPUR register to enable the internal pull up pin */
+				Port_SeedShadow(port_Num);
+				Port_ProgramPort(port_Num, &ConfigPtr->Ports[port_Num]);
 			}
-			else if(internal_Resistor == PORT_PIN_PULL_DOWN)
+			else if(ConfigPtr->clock_Mask & (1U << port_Num))
 			{
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , pin_Num);     /* Set the corresponding bit in the GPIOPDR register to enable the internal pull down pin */
+				Port_PortImageType Diff;
+				Port_DiffImage(port_Num, &Active[port_Num], &ConfigPtr->Ports[port_Num], &Diff);
+				Port_ProgramPort(port_Num, &Diff);
 			}
 			else
 			{
-				CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET) , pin_Num);     /* Clear the corresponding bit in the GPIOPUR register to disable the internal pull up pin */
-				CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET) , pin_Num);   /* Clear the corresponding bit in the GPIOPDR register to disable the internal pull down pin */
+				/* No Action Required */
 			}
 		}
-		else
-		{
-			/* Do Nothing */
-		}
+#if (PORT_CLOCK_GATING == STD_ON)
+		Port_ClockGateIdle();
+#endif
 	}
+	PORT_TRACE_END(PORT_SWITCHCONFIGURATION_SID, PORT_TRACE_NO_PIN, 0);
 }
 
 /************************************************************************************
- * Service Name: Port_RefreshPortDirection
- * Service ID[hex]: 0x02
+ * Service Name: Port_EnterSafeState
+ * Service ID[hex]: 0x11
  * Sync/Async: Synchronous
  * Reentrancy: Non Reentrant
  * Parameters (in): None
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Refreshes port direction
+ * Description: Saves the configuration registers and the pin levels of the used ports and
+ *              applies the safe state images of the active configuration before a low power
+ *              mode. The registers are saved from the RAM shadow, GPIODATA is read once per
+ *              port, and every register is written at most once, only when the safe state
+ *              changes some of its bits. Port_RefreshPortDirection has no effect until
+ *              Port_RestoreState
  ************************************************************************************/
-void Port_RefreshPortDirection(void)
+void Port_EnterSafeState(void)
 {
+	PORT_TRACE_BEGIN();
+	boolean error = FALSE;
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 	/* check if API service called prior to module initialization */
 	if(Port_Status == PORT_NOT_INITIALIZED)
 	{
-		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_REFRESHPORTDIRECTION_SID,
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_ENTERSAFESTATE_SID,
 				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if the pins are already in their safe state, the saved registers would be lost */
+	if(Port_SafeState == TRUE)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_ENTERSAFESTATE_SID,
+				PORT_E_SAFE_STATE);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if an update is open, its staged changes are not part of the saved registers */
+	if(Port_UpdateOpen == TRUE)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_ENTERSAFESTATE_SID,
+				PORT_E_UPDATE_STATE);
+		error = TRUE;
 	}
 	else
+	{
+		/* No Action Required */
+	}
 #endif
+	if(error == FALSE)
 	{
-		for(uint8 i = 0; i < PORT_CONFIGURED_PINS; i++)
+#if (PORT_CLOCK_GATING == STD_ON)
+		/* The pin levels of the gated ports are read as well */
+		Port_ClockEnable(Port_ClockMask);
+#endif
+		for(uint8 port_Num = 0; port_Num < PORT_NUMBER_OF_PORTS; port_Num++)
 		{
-			volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-			uint8 port_Num = Port_Configuration.Pins[i].port_Num;
-			uint8 pin_Num = Port_Configuration.Pins[i].pin_Num;
-			uint8 pin_Direction = Port_Configuration.Pins[i].pin_Direction;
-			switch(port_Num)
+			if(Port_ClockMask & (1U << port_Num))
 			{
-			case  PORTA: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-			break;
-			case  PORTB: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-			break;
-			case  PORTC: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-			break;
-			case  PORTD: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-			break;
-			case  PORTE: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-			break;
-			case  PORTF: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-			break;
-			default: break;
-			}
-			if(PortGpio_Ptr == NULL_PTR)
-			{
-				continue;
+				const Port_RegImageType * Data = &Port_SafeImages[port_Num].Regs[PORT_IMAGE_DATA];
+				Port_PortImageType Diff;
+				uint32 data_Mask;
+
+				Port_SnapshotShadow(port_Num, &Port_Saved[port_Num]);
+				Port_SavedData[port_Num] = (uint8)PORT_REG_READ(Port_BaseAddress[port_Num] + PORT_DATA_REG_OFFSET);
+
+				/* The pin levels were just read, so GPIODATA is diffed like the configuration registers */
+				data_Mask = Data->mask & (Port_SavedData[port_Num] ^ Data->value);
+				Diff.Regs[PORT_IMAGE_DATA].mask = data_Mask;
+				Diff.Regs[PORT_IMAGE_DATA].value = Data->value & data_Mask;
+				Port_ShadowDiff(port_Num, &Port_SafeImages[port_Num], &Diff);
+				Diff.commit_Mask = 0;   /* The locked pins of the port were unlocked by its configuration */
+				Port_ProgramPort(port_Num, &Diff);
 			}
-			/* Refresh PIN Direction */
-			if(pin_Direction == PORT_PIN_OUT)
+			else
 			{
-				SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , pin_Num);                /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
+				/* No Action Required */
 			}
+		}
+		Port_SafeState = TRUE;
+#if (PORT_CLOCK_GATING == STD_ON)
+		/* The ports with disabled inputs only stay gated for the whole low power mode */
+		Port_ClockGateIdle();
+#endif
+	}
+	PORT_TRACE_END(PORT_ENTERSAFESTATE_SID, PORT_TRACE_NO_PIN, 0);
+}
 
-			if(pin_Direction == PORT_PIN_IN)
+/************************************************************************************
+ * Service Name: Port_RestoreState
+ * Service ID[hex]: 0x12
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Writes back the configuration registers and the output levels saved by
+ *              Port_EnterSafeState after a low power mode. Every configuration register is
+ *              written at most once, only when it differs from the RAM shadow, and the output
+ *              levels are written before the directions so the outputs come up at their level
+ ************************************************************************************/
+void Port_RestoreState(void)
+{
+	PORT_TRACE_BEGIN();
+	boolean error = FALSE;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if API service called prior to module initialization */
+	if(Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_RESTORESTATE_SID,
+				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if a state was saved by Port_EnterSafeState */
+	if(Port_SafeState == FALSE)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_RESTORESTATE_SID,
+				PORT_E_SAFE_STATE);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+	if(error == FALSE)
+	{
+#if (PORT_CLOCK_GATING == STD_ON)
+		/* Clock the ports gated by Port_EnterSafeState with one write */
+		Port_ClockEnable(Port_ClockMask);
+#endif
+		for(uint8 port_Num = 0; port_Num < PORT_NUMBER_OF_PORTS; port_Num++)
+		{
+			if(Port_ClockMask & (1U << port_Num))
 			{
-				CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET) , pin_Num);                /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
+				const Port_PortSnapshotType * Saved = &Port_Saved[port_Num];
+				Port_PortImageType Image =
+				{
+						{
+								{ Saved->dir, Port_SavedData[port_Num] & Saved->dir },
+								{ 0xFFFFFFFFU, Saved->ctl },
+								{ 0xFFU, Saved->alt_Func },
+								{ 0xFFU, Saved->analog_Mode_Sel },
+								{ 0xFFU, Saved->digital_Enable },
+								{ 0xFFU, Saved->pull_Up },
+								{ 0xFFU, Saved->pull_Down },
+								{ 0xFFU, Saved->dir }
+						},
+						0
+				};
+
+				/* The output levels are always written, the pins may have been driven in the safe state */
+				Port_ShadowDiff(port_Num, &Image, &Image);
+				Port_ProgramPort(port_Num, &Image);
 			}
 			else
 			{
 				/* No Action Required */
 			}
 		}
+		Port_SafeState = FALSE;
+#if (PORT_CLOCK_GATING == STD_ON)
+		Port_ClockGateIdle();
+#endif
 	}
+	PORT_TRACE_END(PORT_RESTORESTATE_SID, PORT_TRACE_NO_PIN, 0);
 }
 
 /************************************************************************************
- * Service Name: Port_GetVersionInfo
- * Service ID[hex]: 0x03
+ * Service Name: Port_SetPinDriveStrength
+ * Service ID[hex]: 0x13
  * Sync/Async: Synchronous
  * Reentrancy: Non Reentrant
- * Parameters (in): None
+ * Parameters (in): - Pin - Port Pin ID number
+ 	 	 	 	 	- Drive - Output drive strength
  * Parameters (inout): None
- * Parameters (out): versioninfo - Pointer to where to store the version information of this module
+ * Parameters (out): None
  * Return value: None
- * Description: Returns the version information of this module
+ * Description: Sets the output drive strength of a port pin, only the selected GPIODRxR is
+ *              written since the hardware clears the pin in the two others. A pin with slew
+ *              rate control can not leave the 8-mA drive and a pin in analog mode takes no
+ *              pad setting, both are reported as PORT_E_PARAM_DRIVE
  ************************************************************************************/
-#if (PORT_VERSION_INFO_API == STD_ON)
-void Port_GetVersionInfo(Std_VersionInfoType *versioninfo)
+void Port_SetPinDriveStrength(Port_PinType Pin, Port_PinDriveType Drive)
 {
+	PORT_TRACE_BEGIN();
 	boolean error = FALSE;
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 	/* check if API service called prior to module initialization */
 	if(Port_Status == PORT_NOT_INITIALIZED)
 	{
-		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GETVERSIONINFO_SID,
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINDRIVESTRENGTH_SID,
 				PORT_E_UNINIT);
 		error = TRUE;
 	}
@@ -374,10 +2281,26 @@ void Port_GetVersionInfo(Std_VersionInfoType *versioninfo)
 	{
 		/* No Action Required */
 	}
-	if(NULL_PTR == versioninfo)
+	/* check if Incorrect Port Pin ID passed */
+	if (Pin >= PORT_CONFIGURED_PINS)
 	{
-		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GETVERSIONINFO_SID,
-				PORT_E_UNINIT);
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINDRIVESTRENGTH_SID,
+				PORT_E_PARAM_PIN);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if Incorrect drive strength passed, a pin with slew rate control keeps the 8-mA drive
+	 * and a pin in analog mode takes no pad setting */
+	if((Drive > PORT_PIN_DRIVE_8MA)
+			|| ((error == FALSE) && (Drive != PORT_PIN_DRIVE_8MA)
+					&& (Port_PadCheck(&Port_PinDesc[Pin], PORT_IMAGE_SLEW_RATE) == TRUE))
+			|| ((error == FALSE) && (Port_PadCheck(&Port_PinDesc[Pin], PORT_IMAGE_ANALOG_MODE_SEL) == TRUE)))
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINDRIVESTRENGTH_SID,
+				PORT_E_PARAM_DRIVE);
 		error = TRUE;
 	}
 	else
@@ -385,42 +2308,38 @@ void Port_GetVersionInfo(Std_VersionInfoType *versioninfo)
 		/* No Action Required */
 	}
 #endif
+
 	if(error == FALSE)
 	{
-		/* Copy the vendor Id */
-		versioninfo->vendorID = (uint16)PORT_VENDOR_ID;
-		/* Copy the module Id */
-		versioninfo->moduleID = (uint16)PORT_MODULE_ID;
-		/* Copy Software Major Version */
-		versioninfo->sw_major_version = (uint8)PORT_SW_MAJOR_VERSION;
-		/* Copy Software Minor Version */
-		versioninfo->sw_minor_version = (uint8)PORT_SW_MINOR_VERSION;
-		/* Copy Software Patch Version */
-		versioninfo->sw_patch_version = (uint8)PORT_SW_PATCH_VERSION;
+		/* GPIODR2R, GPIODR4R and GPIODR8R follow each other in the register image */
+		Port_WritePad(&Port_PinDesc[Pin], (uint8)(PORT_IMAGE_DRIVE_2MA + Drive), TRUE);
 	}
+	PORT_TRACE_END(PORT_SETPINDRIVESTRENGTH_SID, Pin, Drive);
 }
-#endif
 
 /************************************************************************************
- * Service Name: Port_SetPinMode
- * Service ID[hex]: 0x04
+ * Service Name: Port_SetPinSlewRate
+ * Service ID[hex]: 0x14
  * Sync/Async: Synchronous
- * Reentrancy: Reentrant
+ * Reentrancy: Non Reentrant
  * Parameters (in): - Pin - Port Pin ID number
- * 					- Mode - New Port Pin mode to be set on port pin
+ 	 	 	 	 	- SlewRateControl - Slew rate control enable
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Sets the port pin mode
+ * Description: Enables or disables the slew rate control of a port pin, only GPIOSLR is
+ *              written. The control only takes effect with the 8-mA drive, enabling it on a
+ *              pin with another drive or in analog mode is reported as PORT_E_PARAM_DRIVE
  ************************************************************************************/
-void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
+void Port_SetPinSlewRate(Port_PinType Pin, boolean SlewRateControl)
 {
+	PORT_TRACE_BEGIN();
 	boolean error = FALSE;
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 	/* check if API service called prior to module initialization */
 	if(Port_Status == PORT_NOT_INITIALIZED)
 	{
-		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINMODE_SID,
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINSLEWRATE_SID,
 				PORT_E_UNINIT);
 		error = TRUE;
 	}
@@ -431,7 +2350,7 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
 	/* check if Incorrect Port Pin ID passed */
 	if (Pin >= PORT_CONFIGURED_PINS)
 	{
-		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINMODE_SID,
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINSLEWRATE_SID,
 				PORT_E_PARAM_PIN);
 		error = TRUE;
 	}
@@ -439,22 +2358,72 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
 	{
 		/* No Action Required */
 	}
-	/* check if Port Pin not configured as changeable */
-	if(Port_Pins[Pin].pin_Mode_Changeable == FALSE)
+	/* check if slew rate control is enabled without the 8-mA drive, or on a pin in analog mode */
+	if((error == FALSE) && (((SlewRateControl == TRUE) && (Port_PadCheck(&Port_PinDesc[Pin], PORT_IMAGE_DRIVE_8MA) == FALSE))
+			|| (Port_PadCheck(&Port_PinDesc[Pin], PORT_IMAGE_ANALOG_MODE_SEL) == TRUE)))
 	{
-		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINMODE_SID,
-				PORT_E_DIRECTION_UNCHANGEABLE);
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINSLEWRATE_SID,
+				PORT_E_PARAM_DRIVE);
 		error = TRUE;
 	}
 	else
 	{
 		/* No Action Required */
 	}
-	/* check if Port Pin Mode passed not valid */
-	if(Mode > NO_MODES)
+#endif
+
+	if(error == FALSE)
 	{
-		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINMODE_SID,
-				PORT_E_PARAM_INVALID_MODE);
+		Port_WritePad(&Port_PinDesc[Pin], PORT_IMAGE_SLEW_RATE, SlewRateControl);
+	}
+	PORT_TRACE_END(PORT_SETPINSLEWRATE_SID, Pin, SlewRateControl);
+}
+
+/************************************************************************************
+ * Service Name: Port_SetPinOpenDrain
+ * Service ID[hex]: 0x15
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): - Pin - Port Pin ID number
+ 	 	 	 	 	- OpenDrain - Open drain enable
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Enables or disables the open drain output of a port pin, only GPIOODR is
+ *              written. A pin in analog mode is reported as PORT_E_PARAM_DRIVE
+ ************************************************************************************/
+void Port_SetPinOpenDrain(Port_PinType Pin, boolean OpenDrain)
+{
+	PORT_TRACE_BEGIN();
+	boolean error = FALSE;
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+	/* check if API service called prior to module initialization */
+	if(Port_Status == PORT_NOT_INITIALIZED)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINOPENDRAIN_SID,
+				PORT_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if Incorrect Port Pin ID passed */
+	if (Pin >= PORT_CONFIGURED_PINS)
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINOPENDRAIN_SID,
+				PORT_E_PARAM_PIN);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* check if the pin is in analog mode, it takes no pad setting */
+	if((error == FALSE) && (Port_PadCheck(&Port_PinDesc[Pin], PORT_IMAGE_ANALOG_MODE_SEL) == TRUE))
+	{
+		Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SETPINOPENDRAIN_SID,
+				PORT_E_PARAM_DRIVE);
 		error = TRUE;
 	}
 	else
@@ -462,52 +2431,10 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
 		/* No Action Required */
 	}
 #endif
+
 	if(error == FALSE)
 	{
-		volatile uint32 * PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
-		uint8 port_Num = Port_Pins[Pin].port_Num;
-		uint8 pin_Num = Port_Pins[Pin].pin_Num;
-		uint8 pin_Mode = Port_Pins[Pin].pin_Mode;
-		switch(port_Num)
-		{
-		case  PORTA: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-		break;
-		case  PORTB: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-		break;
-		case  PORTC: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-		break;
-		case  PORTD: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-		break;
-		case  PORTE: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-		break;
-		case  PORTF: PortGpio_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-		break;
-		default: break;
-		}
-		if(PortGpio_Ptr == NULL_PTR)
-		{
-			return;
-		}
-		/* Setup Pin Mode */
-		if(pin_Mode == PORT_MODE_DIO)
-		{
-			CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , pin_Num);      /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-			CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , pin_Num);             /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-			*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (pin_Num * 4));     /* Clear the PMCx bits for this pin */
-			SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , pin_Num);         /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-		}
-		else if(pin_Mode == PORT_MODE_ANALOG)
-		{
-			SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , pin_Num);         /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-			CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET) , pin_Num);        /* Clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-		}
-		else
-		{
-			CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET) , pin_Num);          /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-			SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET) , pin_Num);                   /* enable Alternative function for this pin */
-			*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) &= ~(0x0000000F << (pin_Num * 4));         /* Clear the PMCx bits for this pin */
-			*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_CTL_REG_OFFSET) |= (pin_Mode << (pin_Num * 4));      	  /* Set the PMCx bits for this pin to the selected Alternate function in the configurations */
-		}
+		Port_WritePad(&Port_PinDesc[Pin], PORT_IMAGE_OPEN_DRAIN, OpenDrain);
 	}
+	PORT_TRACE_END(PORT_SETPINOPENDRAIN_SID, Pin, OpenDrain);
 }
-
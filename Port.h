@@ -63,6 +63,32 @@
 #define PIN8		(uint8)0x01
 
 
+/* Number of GPIO ports in the Microcontroller */
+#define PORT_NUMBER_OF_PORTS	(6U)
+
+/* Number of pins in one GPIO port */
+#define PORT_PINS_PER_PORT	(8U)
+
+/* Indices of the GPIO registers inside a port register image, in programming order */
+#define PORT_IMAGE_DATA			(0U)
+#define PORT_IMAGE_CTL			(1U)
+#define PORT_IMAGE_ALT_FUNC		(2U)
+#define PORT_IMAGE_ANALOG_MODE_SEL	(3U)
+#define PORT_IMAGE_DIGITAL_ENABLE	(4U)
+#define PORT_IMAGE_PULL_UP		(5U)
+#define PORT_IMAGE_PULL_DOWN		(6U)
+#define PORT_IMAGE_DIR			(7U)
+#define PORT_IMAGE_DRIVE_2MA		(8U)
+#define PORT_IMAGE_DRIVE_4MA		(9U)
+#define PORT_IMAGE_DRIVE_8MA		(10U)
+#define PORT_IMAGE_OPEN_DRAIN		(11U)
+#define PORT_IMAGE_SLEW_RATE		(12U)
+#define PORT_IMAGE_REGS			(13U)
+
+/* First pad register of a port register image, the pad registers are only read once a pad setting is programmed */
+#define PORT_IMAGE_PAD_FIRST		PORT_IMAGE_DRIVE_2MA
+
+
 /* PIN Modes */
 #define NO_MODES			(15U)
 #define PORT_MODE_DIO		(0U)
@@ -82,6 +108,71 @@
 #define PORT_MODE_ALT14         (14U)
 #define PORT_MODE_ANALOG	(15U)
 
+/* Bit of a pin mode in a pin mode capability mask, one bit per mode from PORT_MODE_DIO to PORT_MODE_ANALOG.
+ * The mode is masked so the bit of an out of range mode is defined, its range is checked apart */
+#define PORT_MODE_BIT(Mode)		((uint16)(1U << ((Mode) & 0x0FU)))
+#define PORT_MODE_DIO_BIT		PORT_MODE_BIT(PORT_MODE_DIO)
+#define PORT_MODE_ANALOG_BIT		PORT_MODE_BIT(PORT_MODE_ANALOG)
+
+/* Modes supported by every pin of the TM4C123GH6PM (data sheet table 23-5), PORT_MODE_BIT(n) is PORT_MODE_ALTn,
+ * 0 for the pins that are not bonded. The one table is expanded by the driver, by Tools/Port_CfgGen and by the
+ * build time checks, Port and Pin are passed on to every ROW */
+#define PORT_PIN_MODES_TABLE(ROW, Port, Pin) \
+	ROW(Port, Pin, PORTA, PIN0, PORT_MODE_DIO_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(8))        /* PA0: U0Rx CAN1Rx */ \
+	ROW(Port, Pin, PORTA, PIN1, PORT_MODE_DIO_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(8))        /* PA1: U0Tx CAN1Tx */ \
+	ROW(Port, Pin, PORTA, PIN2, PORT_MODE_DIO_BIT | PORT_MODE_BIT(2))                           /* PA2: SSI0Clk */ \
+	ROW(Port, Pin, PORTA, PIN3, PORT_MODE_DIO_BIT | PORT_MODE_BIT(2))                           /* PA3: SSI0Fss */ \
+	ROW(Port, Pin, PORTA, PIN4, PORT_MODE_DIO_BIT | PORT_MODE_BIT(2))                           /* PA4: SSI0Rx */ \
+	ROW(Port, Pin, PORTA, PIN5, PORT_MODE_DIO_BIT | PORT_MODE_BIT(2))                           /* PA5: SSI0Tx */ \
+	ROW(Port, Pin, PORTA, PIN6, PORT_MODE_DIO_BIT | PORT_MODE_BIT(3) | PORT_MODE_BIT(5))        /* PA6: I2C1SCL M1PWM2 */ \
+	ROW(Port, Pin, PORTA, PIN7, PORT_MODE_DIO_BIT | PORT_MODE_BIT(3) | PORT_MODE_BIT(5))        /* PA7: I2C1SDA M1PWM3 */ \
+	ROW(Port, Pin, PORTB, PIN0, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(7)) /* PB0: USB0ID U1Rx T2CCP0 */ \
+	ROW(Port, Pin, PORTB, PIN1, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(7)) /* PB1: USB0VBUS U1Tx T2CCP1 */ \
+	ROW(Port, Pin, PORTB, PIN2, PORT_MODE_DIO_BIT | PORT_MODE_BIT(3) | PORT_MODE_BIT(7))        /* PB2: I2C0SCL T3CCP0 */ \
+	ROW(Port, Pin, PORTB, PIN3, PORT_MODE_DIO_BIT | PORT_MODE_BIT(3) | PORT_MODE_BIT(7))        /* PB3: I2C0SDA T3CCP1 */ \
+	ROW(Port, Pin, PORTB, PIN4, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(2) | PORT_MODE_BIT(4) | PORT_MODE_BIT(7) | PORT_MODE_BIT(8)) /* PB4: AIN10 SSI2Clk M0PWM2 T1CCP0 CAN0Rx */ \
+	ROW(Port, Pin, PORTB, PIN5, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(2) | PORT_MODE_BIT(4) | PORT_MODE_BIT(7) | PORT_MODE_BIT(8)) /* PB5: AIN11 SSI2Fss M0PWM3 T1CCP1 CAN0Tx */ \
+	ROW(Port, Pin, PORTB, PIN6, PORT_MODE_DIO_BIT | PORT_MODE_BIT(2) | PORT_MODE_BIT(4) | PORT_MODE_BIT(7)) /* PB6: SSI2Rx M0PWM0 T0CCP0 */ \
+	ROW(Port, Pin, PORTB, PIN7, PORT_MODE_DIO_BIT | PORT_MODE_BIT(2) | PORT_MODE_BIT(4) | PORT_MODE_BIT(7)) /* PB7: SSI2Tx M0PWM1 T0CCP1 */ \
+	ROW(Port, Pin, PORTC, PIN0, PORT_MODE_DIO_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(7))        /* PC0: TCK/SWCLK T4CCP0 */ \
+	ROW(Port, Pin, PORTC, PIN1, PORT_MODE_DIO_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(7))        /* PC1: TMS/SWDIO T4CCP1 */ \
+	ROW(Port, Pin, PORTC, PIN2, PORT_MODE_DIO_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(7))        /* PC2: TDI T5CCP0 */ \
+	ROW(Port, Pin, PORTC, PIN3, PORT_MODE_DIO_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(7))        /* PC3: TDO/SWO T5CCP1 */ \
+	ROW(Port, Pin, PORTC, PIN4, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(2) | PORT_MODE_BIT(4) | PORT_MODE_BIT(6) | PORT_MODE_BIT(7) | PORT_MODE_BIT(8)) /* PC4: C1- U4Rx U1Rx M0PWM6 IDX1 WT0CCP0 U1RTS */ \
+	ROW(Port, Pin, PORTC, PIN5, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(2) | PORT_MODE_BIT(4) | PORT_MODE_BIT(6) | PORT_MODE_BIT(7) | PORT_MODE_BIT(8)) /* PC5: C1+ U4Tx U1Tx M0PWM7 PhA1 WT0CCP1 U1CTS */ \
+	ROW(Port, Pin, PORTC, PIN6, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(6) | PORT_MODE_BIT(7) | PORT_MODE_BIT(8)) /* PC6: C0+ U3Rx PhB1 WT1CCP0 USB0EPEN */ \
+	ROW(Port, Pin, PORTC, PIN7, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(7) | PORT_MODE_BIT(8)) /* PC7: C0- U3Tx WT1CCP1 USB0PFLT */ \
+	ROW(Port, Pin, PORTD, PIN0, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(2) | PORT_MODE_BIT(3) | PORT_MODE_BIT(4) | PORT_MODE_BIT(5) | PORT_MODE_BIT(7)) /* PD0: AIN7 SSI3Clk SSI1Clk I2C3SCL M0PWM6 M1PWM0 WT2CCP0 */ \
+	ROW(Port, Pin, PORTD, PIN1, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(2) | PORT_MODE_BIT(3) | PORT_MODE_BIT(4) | PORT_MODE_BIT(5) | PORT_MODE_BIT(7)) /* PD1: AIN6 SSI3Fss SSI1Fss I2C3SDA M0PWM7 M1PWM1 WT2CCP1 */ \
+	ROW(Port, Pin, PORTD, PIN2, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(2) | PORT_MODE_BIT(4) | PORT_MODE_BIT(7) | PORT_MODE_BIT(8)) /* PD2: AIN5 SSI3Rx SSI1Rx M0FAULT0 WT3CCP0 USB0EPEN */ \
+	ROW(Port, Pin, PORTD, PIN3, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(2) | PORT_MODE_BIT(6) | PORT_MODE_BIT(7) | PORT_MODE_BIT(8)) /* PD3: AIN4 SSI3Tx SSI1Tx IDX0 WT3CCP1 USB0PFLT */ \
+	ROW(Port, Pin, PORTD, PIN4, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(7)) /* PD4: USB0DM U6Rx WT4CCP0 */ \
+	ROW(Port, Pin, PORTD, PIN5, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(7)) /* PD5: USB0DP U6Tx WT4CCP1 */ \
+	ROW(Port, Pin, PORTD, PIN6, PORT_MODE_DIO_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(4) | PORT_MODE_BIT(6) | PORT_MODE_BIT(7)) /* PD6: U2Rx M0FAULT0 PhA0 WT5CCP0 */ \
+	ROW(Port, Pin, PORTD, PIN7, PORT_MODE_DIO_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(6) | PORT_MODE_BIT(7) | PORT_MODE_BIT(8)) /* PD7: U2Tx PhB0 WT5CCP1 NMI */ \
+	ROW(Port, Pin, PORTE, PIN0, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(1))    /* PE0: AIN3 U7Rx */ \
+	ROW(Port, Pin, PORTE, PIN1, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(1))    /* PE1: AIN2 U7Tx */ \
+	ROW(Port, Pin, PORTE, PIN2, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT)                       /* PE2: AIN1 */ \
+	ROW(Port, Pin, PORTE, PIN3, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT)                       /* PE3: AIN0 */ \
+	ROW(Port, Pin, PORTE, PIN4, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(3) | PORT_MODE_BIT(4) | PORT_MODE_BIT(5) | PORT_MODE_BIT(8)) /* PE4: AIN9 U5Rx I2C2SCL M0PWM4 M1PWM2 CAN0Rx */ \
+	ROW(Port, Pin, PORTE, PIN5, PORT_MODE_DIO_BIT | PORT_MODE_ANALOG_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(3) | PORT_MODE_BIT(4) | PORT_MODE_BIT(5) | PORT_MODE_BIT(8)) /* PE5: AIN8 U5Tx I2C2SDA M0PWM5 M1PWM3 CAN0Tx */ \
+	ROW(Port, Pin, PORTE, PIN6, 0)                                                              /* PE6: not bonded */ \
+	ROW(Port, Pin, PORTE, PIN7, 0)                                                              /* PE7: not bonded */ \
+	ROW(Port, Pin, PORTF, PIN0, PORT_MODE_DIO_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(2) | PORT_MODE_BIT(3) | PORT_MODE_BIT(5) | PORT_MODE_BIT(6) | PORT_MODE_BIT(7) | PORT_MODE_BIT(8) | PORT_MODE_BIT(9)) /* PF0: U1RTS SSI1Rx CAN0Rx M1PWM4 PhA0 T0CCP0 NMI C0o */ \
+	ROW(Port, Pin, PORTF, PIN1, PORT_MODE_DIO_BIT | PORT_MODE_BIT(1) | PORT_MODE_BIT(2) | PORT_MODE_BIT(5) | PORT_MODE_BIT(6) | PORT_MODE_BIT(7) | PORT_MODE_BIT(9) | PORT_MODE_BIT(14)) /* PF1: U1CTS SSI1Tx M1PWM5 PhB0 T0CCP1 C1o TRD1 */ \
+	ROW(Port, Pin, PORTF, PIN2, PORT_MODE_DIO_BIT | PORT_MODE_BIT(2) | PORT_MODE_BIT(4) | PORT_MODE_BIT(5) | PORT_MODE_BIT(7) | PORT_MODE_BIT(14)) /* PF2: SSI1Clk M0FAULT0 M1PWM6 T1CCP0 TRD0 */ \
+	ROW(Port, Pin, PORTF, PIN3, PORT_MODE_DIO_BIT | PORT_MODE_BIT(2) | PORT_MODE_BIT(3) | PORT_MODE_BIT(5) | PORT_MODE_BIT(7) | PORT_MODE_BIT(14)) /* PF3: SSI1Fss CAN0Tx M1PWM7 T1CCP1 TRCLK */ \
+	ROW(Port, Pin, PORTF, PIN4, PORT_MODE_DIO_BIT | PORT_MODE_BIT(5) | PORT_MODE_BIT(6) | PORT_MODE_BIT(7) | PORT_MODE_BIT(8)) /* PF4: M1FAULT0 IDX0 T2CCP0 USB0EPEN */ \
+	ROW(Port, Pin, PORTF, PIN5, 0)                                                              /* PF5: not bonded */ \
+	ROW(Port, Pin, PORTF, PIN6, 0)                                                              /* PF6: not bonded */ \
+	ROW(Port, Pin, PORTF, PIN7, 0)                                                              /* PF7: not bonded */
+
+/* Expansions of one row of the table: the designated initializer of a [PORT_NUMBER_OF_PORTS][PORT_PINS_PER_PORT]
+ * array, Port and Pin are unused, or a term selecting the modes of Port and Pin in a constant expression */
+#define PORT_PIN_MODES_INITIALIZER(Port, Pin, RowPort, RowPin, Modes)    [RowPort][RowPin] = (Modes),
+#define PORT_PIN_MODES_SELECT(Port, Pin, RowPort, RowPin, Modes)         (((Port) == (RowPort)) && ((Pin) == (RowPin))) ? (Modes) :
+#define PORT_PIN_MODES_OF(Port, Pin)    (PORT_PIN_MODES_TABLE(PORT_PIN_MODES_SELECT, Port, Pin) 0U)
+
 /* Standard AUTOSAR types */
 #include "Std_Types.h"
 
@@ -109,6 +200,11 @@
   #error "The SW version of Port_Cfg.h does not match the expected version"
 #endif
 
+/* Port_RefreshPortDirection services between one and every port per call */
+#if ((PORT_REFRESH_PORTS_PER_CALL == 0) || (PORT_REFRESH_PORTS_PER_CALL > PORT_NUMBER_OF_PORTS))
+  #error "PORT_REFRESH_PORTS_PER_CALL must be between 1 and PORT_NUMBER_OF_PORTS"
+#endif
+
 /* Non AUTOSAR files */
 #include "Common_Macros.h"
 
@@ -131,6 +227,57 @@
 /* Service ID for Port_SetPinMode */
 #define PORT_SETPINMODE_SID				(uint8)0x04
 
+/* Service ID for Port_WritePin */
+#define PORT_WRITEPIN_SID				(uint8)0x05
+
+/* Service ID for Port_WritePort */
+#define PORT_WRITEPORT_SID				(uint8)0x06
+
+/* Service ID for Port_SetPinGroup */
+#define PORT_SETPINGROUP_SID			(uint8)0x07
+
+/* Service ID for Port_BeginUpdate */
+#define PORT_BEGINUPDATE_SID			(uint8)0x08
+
+/* Service ID for Port_CommitUpdate */
+#define PORT_COMMITUPDATE_SID			(uint8)0x09
+
+/* Service ID for Port_GetPinDirection */
+#define PORT_GETPINDIRECTION_SID		(uint8)0x0A
+
+/* Service ID for Port_GetPinMode */
+#define PORT_GETPINMODE_SID				(uint8)0x0B
+
+/* Service ID for Port_GetPortSnapshot */
+#define PORT_GETPORTSNAPSHOT_SID		(uint8)0x0C
+
+/* Service ID for Port_GetDriftCount */
+#define PORT_GETDRIFTCOUNT_SID			(uint8)0x0D
+
+/* Service ID for Port_GetSweepCount */
+#define PORT_GETSWEEPCOUNT_SID			(uint8)0x0E
+
+/* Service ID for Port_VerifyConfiguration */
+#define PORT_VERIFYCONFIGURATION_SID	(uint8)0x0F
+
+/* Service ID for Port_SwitchConfiguration */
+#define PORT_SWITCHCONFIGURATION_SID	(uint8)0x10
+
+/* Service ID for Port_EnterSafeState */
+#define PORT_ENTERSAFESTATE_SID			(uint8)0x11
+
+/* Service ID for Port_RestoreState */
+#define PORT_RESTORESTATE_SID			(uint8)0x12
+
+/* Service ID for Port_SetPinDriveStrength */
+#define PORT_SETPINDRIVESTRENGTH_SID	(uint8)0x13
+
+/* Service ID for Port_SetPinSlewRate */
+#define PORT_SETPINSLEWRATE_SID			(uint8)0x14
+
+/* Service ID for Port_SetPinOpenDrain */
+#define PORT_SETPINOPENDRAIN_SID		(uint8)0x15
+
 
 /*******************************************************************************
  *                      DET Error Codes                                        *
@@ -156,6 +303,19 @@
 /* APIs called with a Null Pointer */
 #define PORT_E_PARAM_POINTER			(uint8)0x10
 
+/* DET code to report Invalid Port ID requested */
+#define PORT_E_PARAM_PORT				(uint8)0x11
+
+/* DET code to report Port_BeginUpdate called with an update open or Port_CommitUpdate called without one */
+#define PORT_E_UPDATE_STATE				(uint8)0x12
+
+/* DET code to report Port_EnterSafeState called in the safe state or Port_RestoreState called out of it */
+#define PORT_E_SAFE_STATE				(uint8)0x13
+
+/* DET code to report an invalid drive strength, slew rate control without the 8-mA drive,
+ * or a pad setting of a pin in analog mode */
+#define PORT_E_PARAM_DRIVE				(uint8)0x14
+
 
 /*******************************************************************************
  *                              Module Data Types                              *
@@ -182,9 +342,34 @@ typedef enum
     PORT_PIN_OFF,PORT_PIN_PULL_UP,PORT_PIN_PULL_DOWN
 }Port_InternalResistor;
 
+/* Enumeration type to hold the output drive strength of a port PIN, GPIODR2R/GPIODR4R/GPIODR8R */
+typedef enum
+{
+    PORT_PIN_DRIVE_2MA,PORT_PIN_DRIVE_4MA,PORT_PIN_DRIVE_8MA
+}Port_PinDriveType;
+
 
 
 /* Structure Type for type of the external data structure containing the initialization data for this module */
+#if (PORT_PACKED_PINS == STD_ON)
+/* Packed into one 32-bit word, 4 bytes of which 20 bits are used, with the same field names and
+ * order so the driver and the generated configuration use either layout unchanged. The size is
+ * checked at build time against the 2 to 4 bytes a packed pin record may take */
+typedef struct
+{
+	uint32 port_Num : 3;
+	uint32 pin_Num : 3;
+	uint32 pin_Direction : 1;               /* Port_PinDirection */
+	uint32 internal_Resistor : 2;           /* Port_InternalResistor */
+	uint32 pin_Init_Value : 1;              /* STD_LOW or STD_HIGH */
+	uint32 pin_Mode : 4;                    /* Port_PinModeType */
+	uint32 pin_Direction_Changeable : 1;    /* boolean */
+	uint32 pin_Mode_Changeable : 1;         /* boolean */
+	uint32 drive_Strength : 2;              /* Port_PinDriveType */
+	uint32 slew_Rate_Control : 1;           /* boolean, 8-mA drive only */
+	uint32 open_Drain : 1;                  /* boolean */
+}Port_ConfigPin;
+#else
 typedef struct
 {
 	Port_PortType port_Num;
@@ -195,12 +380,97 @@ typedef struct
 	Port_PinModeType pin_Mode;
 	boolean pin_Direction_Changeable;
 	boolean pin_Mode_Changeable;
+	Port_PinDriveType drive_Strength;
+	boolean slew_Rate_Control;       /* 8-mA drive only */
+	boolean open_Drain;
 }Port_ConfigPin;
+#endif
+
+/* Parts of a pin a Port_PinChangeType entry changes */
+#define PORT_CHANGE_DIRECTION	(uint8)0x01
+#define PORT_CHANGE_MODE		(uint8)0x02
+
+/* Structure Type to hold one pin change of a Port_SetPinGroup batch */
+typedef struct
+{
+	Port_PinType pin;
+	uint8 change_Mask;                /* PORT_CHANGE_DIRECTION and/or PORT_CHANGE_MODE */
+	Port_PinDirection pin_Direction;
+	Port_PinModeType pin_Mode;
+}Port_PinChangeType;
+
+/* Structure Type to hold the bits of one GPIO register to be programmed (mask) and their values */
+typedef struct
+{
+	uint32 mask;
+	uint32 value;
+}Port_RegImageType;
+
+/* Structure Type to hold the register image of one GPIO port, folded from all of its configured pins */
+typedef struct
+{
+	Port_RegImageType Regs[PORT_IMAGE_REGS];
+	uint8 commit_Mask;
+}Port_PortImageType;
+
+/* Structure Type to hold the registers of a configured pin, resolved once by Port_Init */
+typedef struct
+{
+	uint32 base_Address;   /* Registers base address of the port the pin belongs to */
+	uint8 pin_Mask;        /* One hot mask of the pin inside the port registers */
+	uint8 ctl_Shift;       /* Position of the PMCx bits of the pin inside GPIOPCTL */
+	uint8 port_Num;
+	uint8 pin_Num;
+}Port_PinDescType;
+
+/* Structure Type to hold the current configuration registers of one GPIO port, as kept in RAM by the driver */
+typedef struct
+{
+	uint32 ctl;                /* GPIOPCTL */
+	uint8 alt_Func;            /* GPIOAFSEL */
+	uint8 analog_Mode_Sel;     /* GPIOAMSEL */
+	uint8 digital_Enable;      /* GPIODEN */
+	uint8 pull_Up;             /* GPIOPUR */
+	uint8 pull_Down;           /* GPIOPDR */
+	uint8 dir;                 /* GPIODIR */
+}Port_PortSnapshotType;
+
+/* Structure Type to hold the result of Port_VerifyConfiguration */
+typedef struct
+{
+	uint16 mismatch_Mask[PORT_NUMBER_OF_PORTS];  /* Bit n set when the register at image index n of the port does not match */
+	uint32 config_Crc;                           /* CRC-32 of the register images of the active configuration */
+}Port_VerifyResultType;
+
+/* Pin field of the trace records of the services without a pin or port parameter */
+#define PORT_TRACE_NO_PIN		(uint8)0xFF
+
+/* Structure Type to hold the trace record of one service call, 12 bytes without padding */
+typedef struct
+{
+	uint32 timestamp;    /* PORT_TRACE_TIMESTAMP() at the end of the call */
+	uint16 sequence;     /* Low bits of the call number, written last so a record being written is recognised */
+	uint16 argument;     /* Direction, mode, level or setting of the call, Mask << 8 | Levels for Port_WritePort */
+	uint8 service_Id;
+	uint8 pin;           /* Pin, or port for the port services, PORT_TRACE_NO_PIN otherwise */
+	uint16 stores;       /* Register stores made during the call, saturated at 0xFFFF */
+}Port_TraceRecordType;
+
+/* Structure Type to hold the trace ring buffer, record n of the calls is in records[n % PORT_TRACE_RECORDS] */
+typedef struct
+{
+	uint32 head;         /* Number of calls recorded since reset */
+	Port_TraceRecordType records[PORT_TRACE_RECORDS];
+}Port_TraceBufferType;
 
 /* Data Structure required for initializing the port Driver */
 typedef struct
 {
 	Port_ConfigPin Pins[PORT_CONFIGURED_PINS];
+	Port_PortImageType Ports[PORT_NUMBER_OF_PORTS];  /* Register images precomputed from the pins by Tools/Port_CfgGen */
+	Port_PortImageType Safe[PORT_NUMBER_OF_PORTS];   /* Register images of the low leakage state applied by Port_EnterSafeState */
+	uint8 clock_Mask;                                /* Clock gating mask of the used ports */
+	uint8 ahb_Mask;                                  /* Ports accessed through the AHB aperture when PORT_AHB_APERTURE is STD_ON */
 }Port_ConfigType;
 
 
@@ -232,6 +502,58 @@ typedef struct
 }Port_ConfigType2;
 
 
+/*******************************************************************************
+ *                      Build Time Configuration Checks                        *
+ *******************************************************************************/
+
+/* Fails the build with a negative array size named after the check when Condition is false */
+#define PORT_STATIC_ASSERT(Condition, Name)    typedef char Name[(Condition) ? 1 : -1]
+
+#if (PORT_PACKED_PINS == STD_ON)
+/* A packed pin record takes 2 to 4 bytes, a new field must not spill it into a second word */
+PORT_STATIC_ASSERT((sizeof(Port_ConfigPin) >= 2U) && (sizeof(Port_ConfigPin) <= 4U), Port_ConfigPin_packed_record_exceeds_4_bytes);
+#endif
+
+/* Expansions of one row of the PIN(...) list Tools/Port_CfgGen emits for every configuration set,
+ * in the field order of Port_ConfigPin: the initializer of the pin, or a term of a constant expression */
+#define PORT_PIN_INITIALIZER(Port, Pin, Direction, Resistor, Level, Mode, DirectionChangeable, ModeChangeable, Drive, Slew, OpenDrain) \
+	{Port, Pin, Direction, Resistor, Level, Mode, DirectionChangeable, ModeChangeable, Drive, Slew, OpenDrain},
+#define PORT_PIN_COUNT(...)    + 1
+/* Pins that do not exist on the device and the JTAG pins PC0 to PC3 */
+#define PORT_PIN_UNAVAILABLE(Port, Pin, ...) \
+	+ (((Port) > PORTF) || ((Pin) > PIN7) || (((Port) == PORTC) && ((Pin) <= PIN3)) \
+	|| (((Port) == PORTE) && ((Pin) > PIN5)) || (((Port) == PORTF) && ((Pin) > PIN4)))
+/* A set of pins has no duplicate when the sum of their one hot bits equals their union */
+#define PORT_PIN_BIT(Port, Pin)                (1ULL << ((((Port) & 7U) * 8U) + ((Pin) & 7U)))
+#define PORT_PIN_BIT_SUM(Port, Pin, ...)       + PORT_PIN_BIT(Port, Pin)
+#define PORT_PIN_BIT_OR(Port, Pin, ...)        | PORT_PIN_BIT(Port, Pin)
+#define PORT_PIN_INVALID(Port, Pin, Direction, Resistor, Level, Mode, DirectionChangeable, ModeChangeable, Drive, Slew, OpenDrain) \
+	+ (((Direction) > PORT_PIN_OUT) || ((Resistor) > PORT_PIN_PULL_DOWN) || ((Level) > STD_HIGH) || ((Mode) > PORT_MODE_ANALOG) \
+	|| ((DirectionChangeable) > TRUE) || ((ModeChangeable) > TRUE) || ((Drive) > PORT_PIN_DRIVE_8MA) || ((Slew) > TRUE) \
+	|| ((OpenDrain) > TRUE) || (((Slew) == TRUE) && ((Drive) != PORT_PIN_DRIVE_8MA)))
+/* Pins set to a mode the pin does not support, PORT_PIN_INVALID reports an out of range mode */
+#define PORT_PIN_MODE_UNSUPPORTED(Port, Pin, Direction, Resistor, Level, Mode, ...) \
+	+ ((PORT_PIN_MODES_OF(Port, Pin) & PORT_MODE_BIT(Mode)) == 0U)
+
+/* Checks the pins of a configuration set at build time: their number, JTAG and missing pins, duplicate
+ * pins, the range of every field and the modes of the pins. A failing check names the set and the rule it breaks */
+#define PORT_CHECK_PINS(Name, PINS) \
+	PORT_STATIC_ASSERT((0 PINS(PORT_PIN_COUNT)) == PORT_CONFIGURED_PINS, Name##_pin_count_differs_from_PORT_CONFIGURED_PINS); \
+	PORT_STATIC_ASSERT((0 PINS(PORT_PIN_UNAVAILABLE)) == 0, Name##_configures_a_JTAG_or_missing_pin); \
+	PORT_STATIC_ASSERT((0ULL PINS(PORT_PIN_BIT_SUM)) == (0ULL PINS(PORT_PIN_BIT_OR)), Name##_configures_a_pin_twice); \
+	PORT_STATIC_ASSERT((0 PINS(PORT_PIN_INVALID)) == 0, Name##_has_an_invalid_pin_setting); \
+	PORT_STATIC_ASSERT((0 PINS(PORT_PIN_MODE_UNSUPPORTED)) == 0, Name##_sets_a_pin_to_a_mode_it_does_not_support)
+
+/* Port_SetPinDirection and Port_SetPinMode on a symbolic pin of Port_PBcfg.h. The build fails when the pin
+ * is not changeable in every configuration set, so the call needs no runtime check of the pin */
+#define PORT_SET_PIN_DIRECTION(PinName, Direction) \
+	((void)sizeof(struct { char PinName##_direction_is_not_changeable[(PinName##_DIRECTION_CHANGEABLE == TRUE) ? 1 : -1]; }), \
+	Port_SetPinDirection((PinName), (Direction)))
+#define PORT_SET_PIN_MODE(PinName, Mode) \
+	((void)sizeof(struct { char PinName##_mode_is_not_changeable[(PinName##_MODE_CHANGEABLE == TRUE) ? 1 : -1]; }), \
+	Port_SetPinMode((PinName), (Mode)))
+
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
@@ -253,6 +575,57 @@ void Port_GetVersionInfo(Std_VersionInfoType *versioninfo);
 /* Function for PORT setup PIN mode */
 void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode);
 
+/* Function for PORT write the level of one PIN */
+void Port_WritePin(Port_PinType Pin, uint8 Level);
+
+/* Function for PORT write the levels of a group of PINs of one PORT */
+void Port_WritePort(Port_PortType Port, uint8 Mask, uint8 Levels);
+
+/* Function for PORT change the direction and/or mode of a group of PINs */
+void Port_SetPinGroup(const Port_PinChangeType * Changes, uint8 NumberOfChanges);
+
+/* Function for PORT open an update, the following changes are staged until the commit */
+void Port_BeginUpdate(void);
+
+/* Function for PORT write the staged changes to the registers and close the update */
+void Port_CommitUpdate(void);
+
+/* Function for PORT get the current direction of one PIN */
+Port_PinDirection Port_GetPinDirection(Port_PinType Pin);
+
+/* Function for PORT get the current mode of one PIN */
+Port_PinModeType Port_GetPinMode(Port_PinType Pin);
+
+/* Function for PORT get the current configuration registers of one PORT */
+void Port_GetPortSnapshot(Port_PortType Port, Port_PortSnapshotType * Snapshot);
+
+/* Function for PORT get the number of direction drifts repaired on one PORT */
+uint32 Port_GetDriftCount(Port_PortType Port);
+
+/* Function for PORT get the number of completed refresh sweeps */
+uint32 Port_GetSweepCount(void);
+
+/* Function for PORT check the GPIO registers against the active configuration */
+Std_ReturnType Port_VerifyConfiguration(Port_VerifyResultType * Result);
+
+/* Function for PORT switch to another configuration set, writing only what differs */
+void Port_SwitchConfiguration(const Port_ConfigType * ConfigPtr);
+
+/* Function for PORT save the configuration registers and drive the pins to their safe state */
+void Port_EnterSafeState(void);
+
+/* Function for PORT restore the configuration registers saved by Port_EnterSafeState */
+void Port_RestoreState(void);
+
+/* Function for PORT set the output drive strength of one PIN */
+void Port_SetPinDriveStrength(Port_PinType Pin, Port_PinDriveType Drive);
+
+/* Function for PORT enable or disable the slew rate control of one PIN */
+void Port_SetPinSlewRate(Port_PinType Pin, boolean SlewRateControl);
+
+/* Function for PORT enable or disable the open drain output of one PIN */
+void Port_SetPinOpenDrain(Port_PinType Pin, boolean OpenDrain);
+
 
 /*******************************************************************************
  *                       External Variables                                    *
@@ -261,5 +634,13 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode);
 /* Extern PB structures to be used by Port and other modules */
 extern const Port_ConfigType Port_Configuration;
 
+/* Extern table of all the PB structures, Port_ConfigurationSets[0] is Port_Configuration */
+extern const Port_ConfigType * const Port_ConfigurationSets[PORT_CONFIGURATION_SETS];
+
+#if (PORT_TRACE == STD_ON)
+/* Extern trace ring buffer, to be dumped from memory and decoded by Tools/Port_TraceDump */
+extern Port_TraceBufferType Port_Trace;
+#endif
+
 
 #endif /* PORT_H */
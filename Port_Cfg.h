@@ -26,14 +26,79 @@
 #define PORT_CFG_AR_RELEASE_MINOR_VERSION     (0U)
 #define PORT_CFG_AR_RELEASE_PATCH_VERSION     (3U)
 
-/* Pre-compile option for Development Error Detect */
+/* Pre-compile option for Development Error Detect. Port_PBcfg.c is checked at build time, a release build may
+ * turn it off and call the services restricted to changeable pins through PORT_SET_PIN_DIRECTION/PORT_SET_PIN_MODE */
+#ifndef PORT_DEV_ERROR_DETECT
 #define PORT_DEV_ERROR_DETECT                (STD_ON)
+#endif
 
 /* Pre-compile option for Version Info API */
 #define PORT_VERSION_INFO_API                (STD_OFF)
 
-/* Number of the configured port pins */
+/* Pre-compile option to run the driver on the host register model of Tools/Port_Sim.c */
+#ifndef PORT_HOST_SIMULATION
+#define PORT_HOST_SIMULATION                 (STD_OFF)
+#endif
+
+/* Pre-compile option to access the ports selected by ahb_Mask of the post build configuration through the AHB aperture */
+#ifndef PORT_AHB_APERTURE
+#define PORT_AHB_APERTURE                    (STD_OFF)
+#endif
+
+/* Pre-compile option to update single pins through the bit-band alias with one store instead of a read-modify-write */
+#ifndef PORT_BITBAND_ACCESS
+#define PORT_BITBAND_ACCESS                  (STD_OFF)
+#endif
+
+/* Pre-compile option to pack every Port_ConfigPin into a 32-bit record instead of one byte or enum per field */
+#ifndef PORT_PACKED_PINS
+#define PORT_PACKED_PINS                     (STD_OFF)
+#endif
+
+/* Pre-compile option to gate the clock of a used port while none of its pins is digitally enabled */
+#ifndef PORT_CLOCK_GATING
+#define PORT_CLOCK_GATING                    (STD_OFF)
+#endif
+
+/* Pre-compile option to make the reentrant services update the shared GPIO registers and RAM shadow with
+ * load-exclusive/store-exclusive compare and swap loops, so concurrent callers never lose each other's pins */
+#ifndef PORT_ATOMIC_ACCESS
+#define PORT_ATOMIC_ACCESS                   (STD_OFF)
+#endif
+
+/* Pre-compile option to protect the reentrant services with the SchM exclusive area PORT_EXCLUSIVE_AREA_0 instead */
+#ifndef PORT_EXCLUSIVE_AREAS
+#define PORT_EXCLUSIVE_AREAS                 (STD_OFF)
+#endif
+
+/* Pre-compile option to record the calls of the services that write the registers into the trace ring buffer
+ * Port_Trace, decoded from a memory dump by Tools/Port_TraceDump. STD_OFF compiles every trace point out */
+#ifndef PORT_TRACE
+#define PORT_TRACE                           (STD_OFF)
+#endif
+
+/* Number of records of the trace ring buffer, a power of two so the write index wraps with a mask */
+#ifndef PORT_TRACE_RECORDS
+#define PORT_TRACE_RECORDS                   (64U)
+#endif
+
+/* Timestamp hook sampled for every trace record, map it to a free running timer of the application */
+#ifndef PORT_TRACE_TIMESTAMP
+#define PORT_TRACE_TIMESTAMP()               (0U)
+#endif
+
+/* Number of ports Port_RefreshPortDirection services per call in round robin, (6U) refreshes every port on each call */
+#ifndef PORT_REFRESH_PORTS_PER_CALL
+#define PORT_REFRESH_PORTS_PER_CALL          (6U)
+#endif
+
+/* Number of post build configuration sets generated in Port_PBcfg.c */
+#define PORT_CONFIGURATION_SETS              (2U)
+
+/* Number of the configured port pins, the host benchmark overrides it for its synthetic configurations */
+#ifndef PORT_CONFIGURED_PINS
 #define PORT_CONFIGURED_PINS              	 (39U)
+#endif
 
 
 
@@ -5,6 +5,7 @@
  * File Name: Port_PBcfg.c
  *
  * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Port Driver
+ *              Generated by Tools/Port_CfgGen from the pin description, do not edit.
  *
  * Author: Mazen Hekal
  ******************************************************************************/
@@ -41,44 +42,558 @@
 
 
 
+/* Pins of Port_Configuration, one PIN(...) row per Port Pin ID in the field order of Port_ConfigPin */
+#define PORT_CONFIGURATION_PINS(PIN) \
+		PIN(PORTA,PIN0,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PA0*/ \
+		PIN(PORTA,PIN1,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PA1*/ \
+		PIN(PORTA,PIN2,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PA2*/ \
+		PIN(PORTA,PIN3,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PA3*/ \
+		PIN(PORTA,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PA4*/ \
+		PIN(PORTA,PIN5,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PA5*/ \
+		PIN(PORTA,PIN6,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PA6*/ \
+		PIN(PORTA,PIN7,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PA7*/ \
+		PIN(PORTB,PIN0,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PB0*/ \
+		PIN(PORTB,PIN1,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PB1*/ \
+		PIN(PORTB,PIN2,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PB2*/ \
+		PIN(PORTB,PIN3,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PB3*/ \
+		PIN(PORTB,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PB4*/ \
+		PIN(PORTB,PIN5,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PB5*/ \
+		PIN(PORTB,PIN6,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PB6*/ \
+		PIN(PORTB,PIN7,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PB7*/ \
+		PIN(PORTC,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PC4*/ \
+		PIN(PORTC,PIN5,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PC5*/ \
+		PIN(PORTC,PIN6,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PC6*/ \
+		PIN(PORTC,PIN7,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PC7*/ \
+		PIN(PORTD,PIN0,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PD0*/ \
+		PIN(PORTD,PIN1,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PD1*/ \
+		PIN(PORTD,PIN2,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PD2*/ \
+		PIN(PORTD,PIN3,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PD3*/ \
+		PIN(PORTD,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PD4*/ \
+		PIN(PORTD,PIN5,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PD5*/ \
+		PIN(PORTD,PIN6,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PD6*/ \
+		PIN(PORTD,PIN7,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PD7*/ \
+		PIN(PORTE,PIN0,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PE0*/ \
+		PIN(PORTE,PIN1,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PE1*/ \
+		PIN(PORTE,PIN2,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PE2*/ \
+		PIN(PORTE,PIN3,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PE3*/ \
+		PIN(PORTE,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PE4*/ \
+		PIN(PORTE,PIN5,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PE5*/ \
+		PIN(PORTF,PIN0,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PF0*/ \
+		PIN(PORTF,PIN1,PORT_PIN_OUT,PORT_PIN_OFF,STD_LOW,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PF1*/ \
+		PIN(PORTF,PIN2,PORT_PIN_OUT,PORT_PIN_OFF,STD_LOW,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PF2*/ \
+		PIN(PORTF,PIN3,PORT_PIN_OUT,PORT_PIN_OFF,STD_LOW,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PF3*/ \
+		PIN(PORTF,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PF4*/
+
+PORT_CHECK_PINS(Port_Configuration, PORT_CONFIGURATION_PINS);
+
 const Port_ConfigType Port_Configuration = {
-		PORTA,PIN0,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PA0*/
-		PORTA,PIN1,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PA1*/
-		PORTA,PIN2,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PA2*/
-		PORTA,PIN3,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PA3*/
-		PORTA,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PA4*/
-		PORTA,PIN5,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PA5*/
-		PORTA,PIN6,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PA6*/
-		PORTA,PIN7,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PA7*/
-		PORTB,PIN0,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PB0*/
-		PORTB,PIN1,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PB1*/
-		PORTB,PIN2,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PB2*/
-		PORTB,PIN3,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PB3*/
-		PORTB,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PB4*/
-		PORTB,PIN5,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PB5*/
-		PORTB,PIN6,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PB6*/
-		PORTB,PIN7,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PB7*/
-		PORTC,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PC4*/
-		PORTC,PIN5,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PC5*/
-		PORTC,PIN6,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PC6*/
-		PORTC,PIN7,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PC7*/
-		PORTD,PIN0,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PD0*/
-		PORTD,PIN1,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PD1*/
-		PORTD,PIN2,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PD2*/
-		PORTD,PIN3,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PD3*/
-		PORTD,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PD4*/
-		PORTD,PIN5,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PD5*/
-		PORTD,PIN6,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PD6*/
-		PORTD,PIN7,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PD7*/
-		PORTE,PIN0,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PE0*/
-		PORTE,PIN1,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PE1*/
-		PORTE,PIN2,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PE2*/
-		PORTE,PIN3,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PE3*/
-		PORTE,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PE4*/
-		PORTE,PIN5,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,   /*PE5*/
-		PORTF,PIN0,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,	/*PF0*/
-		PORTF,PIN1,PORT_PIN_OUT,PORT_PIN_OFF,STD_LOW,PORT_MODE_DIO,TRUE,TRUE,		/*PF1*/
-		PORTF,PIN2,PORT_PIN_OUT,PORT_PIN_OFF,STD_LOW,PORT_MODE_DIO,TRUE,TRUE,		/*PF2*/
-		PORTF,PIN3,PORT_PIN_OUT,PORT_PIN_OFF,STD_LOW,PORT_MODE_DIO,TRUE,TRUE,		/*PF3*/
-		PORTF,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE	/*PF4*/
+		{
+				PORT_CONFIGURATION_PINS(PORT_PIN_INITIALIZER)
+		},
+		{
+				{	/* PORTA */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0xFFFFFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x000000FF, 0x00000000},	/* GPIOAFSEL */
+								{0x000000FF, 0x00000000},	/* GPIOAMSEL */
+								{0x000000FF, 0x000000FF},	/* GPIODEN */
+								{0x000000FF, 0x000000FF},	/* GPIOPUR */
+								{0x00000000, 0x00000000},	/* GPIOPDR */
+								{0x000000FF, 0x00000000},	/* GPIODIR */
+								{0x000000FF, 0x000000FF},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x000000FF, 0x00000000},	/* GPIOODR */
+								{0x000000FF, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTB */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0xFFFFFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x000000FF, 0x00000000},	/* GPIOAFSEL */
+								{0x000000FF, 0x00000000},	/* GPIOAMSEL */
+								{0x000000FF, 0x000000FF},	/* GPIODEN */
+								{0x000000FF, 0x000000FF},	/* GPIOPUR */
+								{0x00000000, 0x00000000},	/* GPIOPDR */
+								{0x000000FF, 0x00000000},	/* GPIODIR */
+								{0x000000FF, 0x000000FF},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x000000FF, 0x00000000},	/* GPIOODR */
+								{0x000000FF, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTC */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0xFFFF0000, 0x00000000},	/* GPIOPCTL */
+								{0x000000F0, 0x00000000},	/* GPIOAFSEL */
+								{0x000000F0, 0x00000000},	/* GPIOAMSEL */
+								{0x000000F0, 0x000000F0},	/* GPIODEN */
+								{0x000000F0, 0x000000F0},	/* GPIOPUR */
+								{0x00000000, 0x00000000},	/* GPIOPDR */
+								{0x000000F0, 0x00000000},	/* GPIODIR */
+								{0x000000F0, 0x000000F0},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x000000F0, 0x00000000},	/* GPIOODR */
+								{0x000000F0, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTD */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0xFFFFFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x000000FF, 0x00000000},	/* GPIOAFSEL */
+								{0x000000FF, 0x00000000},	/* GPIOAMSEL */
+								{0x000000FF, 0x000000FF},	/* GPIODEN */
+								{0x000000FF, 0x000000FF},	/* GPIOPUR */
+								{0x00000000, 0x00000000},	/* GPIOPDR */
+								{0x000000FF, 0x00000000},	/* GPIODIR */
+								{0x000000FF, 0x000000FF},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x000000FF, 0x00000000},	/* GPIOODR */
+								{0x000000FF, 0x00000000} 	/* GPIOSLR */
+						},
+						0x80									/* GPIOCR unlock mask */
+				},
+				{	/* PORTE */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0x00FFFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x0000003F, 0x00000000},	/* GPIOAFSEL */
+								{0x0000003F, 0x00000000},	/* GPIOAMSEL */
+								{0x0000003F, 0x0000003F},	/* GPIODEN */
+								{0x0000003F, 0x0000003F},	/* GPIOPUR */
+								{0x00000000, 0x00000000},	/* GPIOPDR */
+								{0x0000003F, 0x00000000},	/* GPIODIR */
+								{0x0000003F, 0x0000003F},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x0000003F, 0x00000000},	/* GPIOODR */
+								{0x0000003F, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTF */
+						{
+								{0x0000000E, 0x00000000},	/* GPIODATA */
+								{0x000FFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x0000001F, 0x00000000},	/* GPIOAFSEL */
+								{0x0000001F, 0x00000000},	/* GPIOAMSEL */
+								{0x0000001F, 0x0000001F},	/* GPIODEN */
+								{0x00000011, 0x00000011},	/* GPIOPUR */
+								{0x00000000, 0x00000000},	/* GPIOPDR */
+								{0x0000001F, 0x0000000E},	/* GPIODIR */
+								{0x0000001F, 0x0000001F},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x0000001F, 0x00000000},	/* GPIOODR */
+								{0x0000001F, 0x00000000} 	/* GPIOSLR */
+						},
+						0x01									/* GPIOCR unlock mask */
+				}
+		},
+		/* Safe state */
+		{
+				{	/* PORTA */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0xFFFFFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x000000FF, 0x00000000},	/* GPIOAFSEL */
+								{0x000000FF, 0x00000000},	/* GPIOAMSEL */
+								{0x000000FF, 0x00000000},	/* GPIODEN */
+								{0x000000FF, 0x00000000},	/* GPIOPUR */
+								{0x000000FF, 0x00000000},	/* GPIOPDR */
+								{0x000000FF, 0x00000000},	/* GPIODIR */
+								{0x00000000, 0x00000000},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x00000000, 0x00000000},	/* GPIOODR */
+								{0x00000000, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTB */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0xFFFFFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x000000FF, 0x00000000},	/* GPIOAFSEL */
+								{0x000000FF, 0x00000000},	/* GPIOAMSEL */
+								{0x000000FF, 0x00000000},	/* GPIODEN */
+								{0x000000FF, 0x00000000},	/* GPIOPUR */
+								{0x000000FF, 0x00000000},	/* GPIOPDR */
+								{0x000000FF, 0x00000000},	/* GPIODIR */
+								{0x00000000, 0x00000000},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x00000000, 0x00000000},	/* GPIOODR */
+								{0x00000000, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTC */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0xFFFF0000, 0x00000000},	/* GPIOPCTL */
+								{0x000000F0, 0x00000000},	/* GPIOAFSEL */
+								{0x000000F0, 0x00000000},	/* GPIOAMSEL */
+								{0x000000F0, 0x00000000},	/* GPIODEN */
+								{0x000000F0, 0x00000000},	/* GPIOPUR */
+								{0x000000F0, 0x00000000},	/* GPIOPDR */
+								{0x000000F0, 0x00000000},	/* GPIODIR */
+								{0x00000000, 0x00000000},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x00000000, 0x00000000},	/* GPIOODR */
+								{0x00000000, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTD */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0xFFFFFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x000000FF, 0x00000000},	/* GPIOAFSEL */
+								{0x000000FF, 0x00000000},	/* GPIOAMSEL */
+								{0x000000FF, 0x00000000},	/* GPIODEN */
+								{0x000000FF, 0x00000000},	/* GPIOPUR */
+								{0x000000FF, 0x00000000},	/* GPIOPDR */
+								{0x000000FF, 0x00000000},	/* GPIODIR */
+								{0x00000000, 0x00000000},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x00000000, 0x00000000},	/* GPIOODR */
+								{0x00000000, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTE */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0x00FFFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x0000003F, 0x00000000},	/* GPIOAFSEL */
+								{0x0000003F, 0x00000000},	/* GPIOAMSEL */
+								{0x0000003F, 0x00000000},	/* GPIODEN */
+								{0x0000003F, 0x00000000},	/* GPIOPUR */
+								{0x0000003F, 0x00000000},	/* GPIOPDR */
+								{0x0000003F, 0x00000000},	/* GPIODIR */
+								{0x00000000, 0x00000000},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x00000000, 0x00000000},	/* GPIOODR */
+								{0x00000000, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTF */
+						{
+								{0x0000000E, 0x00000000},	/* GPIODATA */
+								{0x000FFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x0000001F, 0x00000000},	/* GPIOAFSEL */
+								{0x0000001F, 0x00000000},	/* GPIOAMSEL */
+								{0x0000001F, 0x0000000E},	/* GPIODEN */
+								{0x0000001F, 0x00000000},	/* GPIOPUR */
+								{0x0000001F, 0x00000000},	/* GPIOPDR */
+								{0x0000001F, 0x0000000E},	/* GPIODIR */
+								{0x00000000, 0x00000000},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x00000000, 0x00000000},	/* GPIOODR */
+								{0x00000000, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				}
+		},
+		0x3F,	/* Clock gating mask of the used ports */
+		0x00	/* Ports accessed through the AHB aperture */
+};
+
+/* Configuration set 1 */
+/* Pins of Port_Configuration_Uart0, one PIN(...) row per Port Pin ID in the field order of Port_ConfigPin */
+#define PORT_CONFIGURATION_UART0_PINS(PIN) \
+		PIN(PORTA,PIN0,PORT_PIN_IN,PORT_PIN_OFF,STD_LOW,PORT_MODE_ALT01,FALSE,FALSE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PA0*/ \
+		PIN(PORTA,PIN1,PORT_PIN_OUT,PORT_PIN_OFF,STD_HIGH,PORT_MODE_ALT01,FALSE,FALSE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PA1*/ \
+		PIN(PORTA,PIN2,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PA2*/ \
+		PIN(PORTA,PIN3,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PA3*/ \
+		PIN(PORTA,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PA4*/ \
+		PIN(PORTA,PIN5,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PA5*/ \
+		PIN(PORTA,PIN6,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PA6*/ \
+		PIN(PORTA,PIN7,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PA7*/ \
+		PIN(PORTB,PIN0,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PB0*/ \
+		PIN(PORTB,PIN1,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PB1*/ \
+		PIN(PORTB,PIN2,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PB2*/ \
+		PIN(PORTB,PIN3,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PB3*/ \
+		PIN(PORTB,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PB4*/ \
+		PIN(PORTB,PIN5,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PB5*/ \
+		PIN(PORTB,PIN6,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PB6*/ \
+		PIN(PORTB,PIN7,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PB7*/ \
+		PIN(PORTC,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PC4*/ \
+		PIN(PORTC,PIN5,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PC5*/ \
+		PIN(PORTC,PIN6,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PC6*/ \
+		PIN(PORTC,PIN7,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PC7*/ \
+		PIN(PORTD,PIN0,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PD0*/ \
+		PIN(PORTD,PIN1,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PD1*/ \
+		PIN(PORTD,PIN2,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PD2*/ \
+		PIN(PORTD,PIN3,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PD3*/ \
+		PIN(PORTD,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PD4*/ \
+		PIN(PORTD,PIN5,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PD5*/ \
+		PIN(PORTD,PIN6,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PD6*/ \
+		PIN(PORTD,PIN7,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PD7*/ \
+		PIN(PORTE,PIN0,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PE0*/ \
+		PIN(PORTE,PIN1,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PE1*/ \
+		PIN(PORTE,PIN2,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PE2*/ \
+		PIN(PORTE,PIN3,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PE3*/ \
+		PIN(PORTE,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PE4*/ \
+		PIN(PORTE,PIN5,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PE5*/ \
+		PIN(PORTF,PIN0,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PF0*/ \
+		PIN(PORTF,PIN1,PORT_PIN_OUT,PORT_PIN_OFF,STD_LOW,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PF1*/ \
+		PIN(PORTF,PIN2,PORT_PIN_OUT,PORT_PIN_OFF,STD_LOW,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PF2*/ \
+		PIN(PORTF,PIN3,PORT_PIN_OUT,PORT_PIN_OFF,STD_LOW,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PF3*/ \
+		PIN(PORTF,PIN4,PORT_PIN_IN,PORT_PIN_PULL_UP,STD_HIGH,PORT_MODE_DIO,TRUE,TRUE,PORT_PIN_DRIVE_2MA,FALSE,FALSE)	/*PF4*/
+
+PORT_CHECK_PINS(Port_Configuration_Uart0, PORT_CONFIGURATION_UART0_PINS);
+
+const Port_ConfigType Port_Configuration_Uart0 = {
+		{
+				PORT_CONFIGURATION_UART0_PINS(PORT_PIN_INITIALIZER)
+		},
+		{
+				{	/* PORTA */
+						{
+								{0x00000002, 0x00000002},	/* GPIODATA */
+								{0xFFFFFFFF, 0x00000011},	/* GPIOPCTL */
+								{0x000000FF, 0x00000003},	/* GPIOAFSEL */
+								{0x000000FF, 0x00000000},	/* GPIOAMSEL */
+								{0x000000FF, 0x000000FF},	/* GPIODEN */
+								{0x000000FD, 0x000000FC},	/* GPIOPUR */
+								{0x00000001, 0x00000000},	/* GPIOPDR */
+								{0x000000FF, 0x00000002},	/* GPIODIR */
+								{0x000000FF, 0x000000FF},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x000000FF, 0x00000000},	/* GPIOODR */
+								{0x000000FF, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTB */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0xFFFFFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x000000FF, 0x00000000},	/* GPIOAFSEL */
+								{0x000000FF, 0x00000000},	/* GPIOAMSEL */
+								{0x000000FF, 0x000000FF},	/* GPIODEN */
+								{0x000000FF, 0x000000FF},	/* GPIOPUR */
+								{0x00000000, 0x00000000},	/* GPIOPDR */
+								{0x000000FF, 0x00000000},	/* GPIODIR */
+								{0x000000FF, 0x000000FF},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x000000FF, 0x00000000},	/* GPIOODR */
+								{0x000000FF, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTC */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0xFFFF0000, 0x00000000},	/* GPIOPCTL */
+								{0x000000F0, 0x00000000},	/* GPIOAFSEL */
+								{0x000000F0, 0x00000000},	/* GPIOAMSEL */
+								{0x000000F0, 0x000000F0},	/* GPIODEN */
+								{0x000000F0, 0x000000F0},	/* GPIOPUR */
+								{0x00000000, 0x00000000},	/* GPIOPDR */
+								{0x000000F0, 0x00000000},	/* GPIODIR */
+								{0x000000F0, 0x000000F0},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x000000F0, 0x00000000},	/* GPIOODR */
+								{0x000000F0, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTD */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0xFFFFFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x000000FF, 0x00000000},	/* GPIOAFSEL */
+								{0x000000FF, 0x00000000},	/* GPIOAMSEL */
+								{0x000000FF, 0x000000FF},	/* GPIODEN */
+								{0x000000FF, 0x000000FF},	/* GPIOPUR */
+								{0x00000000, 0x00000000},	/* GPIOPDR */
+								{0x000000FF, 0x00000000},	/* GPIODIR */
+								{0x000000FF, 0x000000FF},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x000000FF, 0x00000000},	/* GPIOODR */
+								{0x000000FF, 0x00000000} 	/* GPIOSLR */
+						},
+						0x80									/* GPIOCR unlock mask */
+				},
+				{	/* PORTE */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0x00FFFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x0000003F, 0x00000000},	/* GPIOAFSEL */
+								{0x0000003F, 0x00000000},	/* GPIOAMSEL */
+								{0x0000003F, 0x0000003F},	/* GPIODEN */
+								{0x0000003F, 0x0000003F},	/* GPIOPUR */
+								{0x00000000, 0x00000000},	/* GPIOPDR */
+								{0x0000003F, 0x00000000},	/* GPIODIR */
+								{0x0000003F, 0x0000003F},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x0000003F, 0x00000000},	/* GPIOODR */
+								{0x0000003F, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTF */
+						{
+								{0x0000000E, 0x00000000},	/* GPIODATA */
+								{0x000FFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x0000001F, 0x00000000},	/* GPIOAFSEL */
+								{0x0000001F, 0x00000000},	/* GPIOAMSEL */
+								{0x0000001F, 0x0000001F},	/* GPIODEN */
+								{0x00000011, 0x00000011},	/* GPIOPUR */
+								{0x00000000, 0x00000000},	/* GPIOPDR */
+								{0x0000001F, 0x0000000E},	/* GPIODIR */
+								{0x0000001F, 0x0000001F},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x0000001F, 0x00000000},	/* GPIOODR */
+								{0x0000001F, 0x00000000} 	/* GPIOSLR */
+						},
+						0x01									/* GPIOCR unlock mask */
+				}
+		},
+		/* Safe state */
+		{
+				{	/* PORTA */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0xFFFFFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x000000FF, 0x00000000},	/* GPIOAFSEL */
+								{0x000000FF, 0x00000000},	/* GPIOAMSEL */
+								{0x000000FF, 0x00000000},	/* GPIODEN */
+								{0x000000FF, 0x00000000},	/* GPIOPUR */
+								{0x000000FF, 0x00000000},	/* GPIOPDR */
+								{0x000000FF, 0x00000000},	/* GPIODIR */
+								{0x00000000, 0x00000000},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x00000000, 0x00000000},	/* GPIOODR */
+								{0x00000000, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTB */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0xFFFFFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x000000FF, 0x00000000},	/* GPIOAFSEL */
+								{0x000000FF, 0x00000000},	/* GPIOAMSEL */
+								{0x000000FF, 0x00000000},	/* GPIODEN */
+								{0x000000FF, 0x00000000},	/* GPIOPUR */
+								{0x000000FF, 0x00000000},	/* GPIOPDR */
+								{0x000000FF, 0x00000000},	/* GPIODIR */
+								{0x00000000, 0x00000000},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x00000000, 0x00000000},	/* GPIOODR */
+								{0x00000000, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTC */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0xFFFF0000, 0x00000000},	/* GPIOPCTL */
+								{0x000000F0, 0x00000000},	/* GPIOAFSEL */
+								{0x000000F0, 0x00000000},	/* GPIOAMSEL */
+								{0x000000F0, 0x00000000},	/* GPIODEN */
+								{0x000000F0, 0x00000000},	/* GPIOPUR */
+								{0x000000F0, 0x00000000},	/* GPIOPDR */
+								{0x000000F0, 0x00000000},	/* GPIODIR */
+								{0x00000000, 0x00000000},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x00000000, 0x00000000},	/* GPIOODR */
+								{0x00000000, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTD */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0xFFFFFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x000000FF, 0x00000000},	/* GPIOAFSEL */
+								{0x000000FF, 0x00000000},	/* GPIOAMSEL */
+								{0x000000FF, 0x00000000},	/* GPIODEN */
+								{0x000000FF, 0x00000000},	/* GPIOPUR */
+								{0x000000FF, 0x00000000},	/* GPIOPDR */
+								{0x000000FF, 0x00000000},	/* GPIODIR */
+								{0x00000000, 0x00000000},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x00000000, 0x00000000},	/* GPIOODR */
+								{0x00000000, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTE */
+						{
+								{0x00000000, 0x00000000},	/* GPIODATA */
+								{0x00FFFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x0000003F, 0x00000000},	/* GPIOAFSEL */
+								{0x0000003F, 0x00000000},	/* GPIOAMSEL */
+								{0x0000003F, 0x00000000},	/* GPIODEN */
+								{0x0000003F, 0x00000000},	/* GPIOPUR */
+								{0x0000003F, 0x00000000},	/* GPIOPDR */
+								{0x0000003F, 0x00000000},	/* GPIODIR */
+								{0x00000000, 0x00000000},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x00000000, 0x00000000},	/* GPIOODR */
+								{0x00000000, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				},
+				{	/* PORTF */
+						{
+								{0x0000000E, 0x00000000},	/* GPIODATA */
+								{0x000FFFFF, 0x00000000},	/* GPIOPCTL */
+								{0x0000001F, 0x00000000},	/* GPIOAFSEL */
+								{0x0000001F, 0x00000000},	/* GPIOAMSEL */
+								{0x0000001F, 0x0000000E},	/* GPIODEN */
+								{0x0000001F, 0x00000000},	/* GPIOPUR */
+								{0x0000001F, 0x00000000},	/* GPIOPDR */
+								{0x0000001F, 0x0000000E},	/* GPIODIR */
+								{0x00000000, 0x00000000},	/* GPIODR2R */
+								{0x00000000, 0x00000000},	/* GPIODR4R */
+								{0x00000000, 0x00000000},	/* GPIODR8R */
+								{0x00000000, 0x00000000},	/* GPIOODR */
+								{0x00000000, 0x00000000} 	/* GPIOSLR */
+						},
+						0x00									/* GPIOCR unlock mask */
+				}
+		},
+		0x3F,	/* Clock gating mask of the used ports */
+		0x00	/* Ports accessed through the AHB aperture */
+};
+
+/* Configuration sets selectable with Port_Init and Port_SwitchConfiguration */
+#if (PORT_CONFIGURATION_SETS != 2U)
+#error "PORT_CONFIGURATION_SETS of Port_Cfg.h does not match the generated configuration sets"
+#endif
+const Port_ConfigType * const Port_ConfigurationSets[PORT_CONFIGURATION_SETS] = {
+		&Port_Configuration,
+		&Port_Configuration_Uart0
 };
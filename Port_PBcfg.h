@@ -0,0 +1,144 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_PBcfg.h
+ *
+ * Description: Symbolic Port Pin IDs of the Post Build Configuration for TM4C123GH6PM Microcontroller - Port Driver
+ *              Generated by Tools/Port_CfgGen from the pin description, do not edit.
+ *
+ * Author: Mazen Hekal
+ ******************************************************************************/
+
+#ifndef PORT_PBCFG_H
+#define PORT_PBCFG_H
+
+#include "Port.h"
+
+#if (PORT_CONFIGURED_PINS != 39U)
+#error "PORT_CONFIGURED_PINS of Port_Cfg.h does not match the generated Port Pin IDs"
+#endif
+
+/* Port Pin IDs, the same pin in every configuration set */
+#define PortConf_PA0				((Port_PinType)0U)
+#define PortConf_PA1				((Port_PinType)1U)
+#define PortConf_PA2				((Port_PinType)2U)
+#define PortConf_PA3				((Port_PinType)3U)
+#define PortConf_PA4				((Port_PinType)4U)
+#define PortConf_PA5				((Port_PinType)5U)
+#define PortConf_PA6				((Port_PinType)6U)
+#define PortConf_PA7				((Port_PinType)7U)
+#define PortConf_PB0				((Port_PinType)8U)
+#define PortConf_PB1				((Port_PinType)9U)
+#define PortConf_PB2				((Port_PinType)10U)
+#define PortConf_PB3				((Port_PinType)11U)
+#define PortConf_PB4				((Port_PinType)12U)
+#define PortConf_PB5				((Port_PinType)13U)
+#define PortConf_PB6				((Port_PinType)14U)
+#define PortConf_PB7				((Port_PinType)15U)
+#define PortConf_PC4				((Port_PinType)16U)
+#define PortConf_PC5				((Port_PinType)17U)
+#define PortConf_PC6				((Port_PinType)18U)
+#define PortConf_PC7				((Port_PinType)19U)
+#define PortConf_PD0				((Port_PinType)20U)
+#define PortConf_PD1				((Port_PinType)21U)
+#define PortConf_PD2				((Port_PinType)22U)
+#define PortConf_PD3				((Port_PinType)23U)
+#define PortConf_PD4				((Port_PinType)24U)
+#define PortConf_PD5				((Port_PinType)25U)
+#define PortConf_PD6				((Port_PinType)26U)
+#define PortConf_PD7				((Port_PinType)27U)
+#define PortConf_PE0				((Port_PinType)28U)
+#define PortConf_PE1				((Port_PinType)29U)
+#define PortConf_PE2				((Port_PinType)30U)
+#define PortConf_PE3				((Port_PinType)31U)
+#define PortConf_PE4				((Port_PinType)32U)
+#define PortConf_PE5				((Port_PinType)33U)
+#define PortConf_PF0				((Port_PinType)34U)
+#define PortConf_PF1				((Port_PinType)35U)
+#define PortConf_PF2				((Port_PinType)36U)
+#define PortConf_PF3				((Port_PinType)37U)
+#define PortConf_PF4				((Port_PinType)38U)
+
+/* Pins whose direction and mode are changeable in every configuration set, checked at build time
+ * by PORT_SET_PIN_DIRECTION and PORT_SET_PIN_MODE */
+#define PortConf_PA0_DIRECTION_CHANGEABLE	(FALSE)
+#define PortConf_PA0_MODE_CHANGEABLE		(FALSE)
+#define PortConf_PA1_DIRECTION_CHANGEABLE	(FALSE)
+#define PortConf_PA1_MODE_CHANGEABLE		(FALSE)
+#define PortConf_PA2_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PA2_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PA3_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PA3_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PA4_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PA4_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PA5_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PA5_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PA6_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PA6_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PA7_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PA7_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PB0_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PB0_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PB1_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PB1_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PB2_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PB2_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PB3_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PB3_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PB4_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PB4_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PB5_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PB5_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PB6_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PB6_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PB7_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PB7_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PC4_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PC4_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PC5_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PC5_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PC6_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PC6_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PC7_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PC7_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PD0_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PD0_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PD1_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PD1_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PD2_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PD2_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PD3_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PD3_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PD4_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PD4_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PD5_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PD5_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PD6_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PD6_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PD7_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PD7_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PE0_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PE0_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PE1_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PE1_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PE2_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PE2_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PE3_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PE3_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PE4_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PE4_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PE5_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PE5_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PF0_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PF0_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PF1_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PF1_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PF2_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PF2_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PF3_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PF3_MODE_CHANGEABLE		(TRUE)
+#define PortConf_PF4_DIRECTION_CHANGEABLE	(TRUE)
+#define PortConf_PF4_MODE_CHANGEABLE		(TRUE)
+
+#endif /* PORT_PBCFG_H */
@@ -25,21 +25,120 @@
 #define GPIO_PORTE_BASE_ADDRESS           0x40024000
 #define GPIO_PORTF_BASE_ADDRESS           0x40025000
 
+/* GPIO Registers base addresses on the Advanced High-Performance Bus aperture */
+#define GPIO_PORTA_AHB_BASE_ADDRESS       0x40058000
+#define GPIO_PORTB_AHB_BASE_ADDRESS       0x40059000
+#define GPIO_PORTC_AHB_BASE_ADDRESS       0x4005A000
+#define GPIO_PORTD_AHB_BASE_ADDRESS       0x4005B000
+#define GPIO_PORTE_AHB_BASE_ADDRESS       0x4005C000
+#define GPIO_PORTF_AHB_BASE_ADDRESS       0x4005D000
+
 /* GPIO Registers offset addresses */
 #define PORT_DATA_REG_OFFSET              0x3FC
 #define PORT_DIR_REG_OFFSET               0x400
 #define PORT_ALT_FUNC_REG_OFFSET          0x420
 #define PORT_PULL_UP_REG_OFFSET           0x510
 #define PORT_PULL_DOWN_REG_OFFSET         0x514
+#define PORT_DRIVE_2MA_REG_OFFSET         0x500
+#define PORT_DRIVE_4MA_REG_OFFSET         0x504
+#define PORT_DRIVE_8MA_REG_OFFSET         0x508
+#define PORT_OPEN_DRAIN_REG_OFFSET        0x50C
+#define PORT_SLEW_RATE_REG_OFFSET         0x518
 #define PORT_DIGITAL_ENABLE_REG_OFFSET    0x51C
 #define PORT_LOCK_REG_OFFSET              0x520
 #define PORT_COMMIT_REG_OFFSET            0x524
 #define PORT_ANALOG_MODE_SEL_REG_OFFSET   0x528
 #define PORT_CTL_REG_OFFSET               0x52C
 
+/* GPIODATA offset that reads or writes only the pins in the mask, address bits [9:2] select the pins */
+#define PORT_DATA_MASKED_OFFSET(mask)     ((uint32)(mask) << 2)
+
+/* Key to be written in the GPIOLOCK register to unlock the GPIOCR register */
+#define PORT_LOCK_KEY                     0x4C4F434B
+
+/* System Control Run Mode Clock Gating Control Register 2 address */
+#define SYSCTL_REGCGC2_ADDRESS            0x400FE108
+
+/* System Control GPIO Peripheral Ready Register address, one bit per port is set once its clock runs */
+#define SYSCTL_PRGPIO_ADDRESS             0x400FEA08
+
+/* System Control GPIO High-Performance Bus Control Register address, one bit per port selects the AHB aperture */
+#define SYSCTL_GPIOHBCTL_ADDRESS          0x400FE06C
+#define SYSCTL_GPIOHBCTL_PORTS_MASK       0x3F
+
+/* Peripheral bit-band region and its alias, one word of the alias maps one bit of the region */
+#define PORT_BITBAND_PERIPH_BASE          0x40000000
+#define PORT_BITBAND_ALIAS_BASE           0x42000000
+
+/* Alias address of one bit of a peripheral register */
+#define PORT_BITBAND_ALIAS_ADDRESS(address, bit) \
+	(PORT_BITBAND_ALIAS_BASE + (((uint32)(address) - PORT_BITBAND_PERIPH_BASE) << 5) + ((uint32)(bit) << 2))
+
+/*******************************************************************************
+ *                              Register Access                                *
+ *******************************************************************************/
+
+#if (PORT_HOST_SIMULATION == STD_ON)
+
+/* Registers are served by the memory backed model of Tools/Port_Sim.c which counts every access */
+#include "Port_Sim.h"
+#define PORT_REG_READ(address)            Port_Sim_Read((uint32)(address))
+#define PORT_REG_WRITE(address, value)    (PORT_TRACE_STORE(), Port_Sim_Write((uint32)(address), (uint32)(value)))
+#define PORT_REG_COMPARE_EXCHANGE(address, expected, desired) \
+	(PORT_TRACE_STORE(), Port_Sim_CompareExchange((uint32)(address), (expected), (uint32)(desired)))
+
+#else
+
+#define PORT_REG_READ(address)            (*((volatile uint32 *)(address)))
+#define PORT_REG_WRITE(address, value)    (PORT_TRACE_STORE(), *((volatile uint32 *)(address)) = (uint32)(value))
+/* LDREX/STREX loop on the register: stores desired and returns TRUE when the register still holds
+ * *expected, otherwise loads the current value into *expected and returns FALSE */
+#define PORT_REG_COMPARE_EXCHANGE(address, expected, desired) \
+	(PORT_TRACE_STORE(), (__atomic_compare_exchange_n((volatile uint32 *)(address), (expected), (uint32)(desired), 0, \
+			__ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) ? TRUE : FALSE)
+
+#endif
+
+/*******************************************************************************
+ *                               Atomic Access                                 *
+ *******************************************************************************/
+
+#if (PORT_ATOMIC_ACCESS == STD_ON)
+
+/* Lock free updates of the RAM state shared by the reentrant services, LDREX/STREX loops on the
+ * Cortex-M4 and the lock free instructions of the host, through the GCC and Clang builtins */
+#define PORT_ATOMIC_LOAD(object)           __atomic_load_n((object), __ATOMIC_SEQ_CST)
+#define PORT_ATOMIC_OR(object, bits)       ((void)__atomic_fetch_or((object), (bits), __ATOMIC_SEQ_CST))
+#define PORT_ATOMIC_AND(object, bits)      ((void)__atomic_fetch_and((object), (bits), __ATOMIC_SEQ_CST))
+
+#else
+
+#define PORT_ATOMIC_LOAD(object)           (*(object))
+#define PORT_ATOMIC_OR(object, bits)       (*(object) |= (bits))
+#define PORT_ATOMIC_AND(object, bits)      (*(object) &= (bits))
+
+#endif
+
+/* The trace ring buffer is claimed with an atomic increment in every build, so any task or ISR
+ * records its calls without a lock */
+#define PORT_ATOMIC_FETCH_ADD(object, value)    __atomic_fetch_add((object), (value), __ATOMIC_SEQ_CST)
+#define PORT_ATOMIC_STORE(object, value)        __atomic_store_n((object), (value), __ATOMIC_RELEASE)
+
+/*******************************************************************************
+ *                                    Trace                                    *
+ *******************************************************************************/
+
+#if (PORT_TRACE == STD_ON)
+
+/* Every register store of the driver is counted for the trace records, the counter is kept by Port.c */
+extern uint32 Port_TraceStores;
+#define PORT_TRACE_STORE()                 ((void)PORT_ATOMIC_FETCH_ADD(&Port_TraceStores, 1U))
+
+#else
 
-#define SYSCTL_REGCGC2_REG        (*((volatile uint32 *)0x400FE108))
+#define PORT_TRACE_STORE()                 ((void)0)
 
+#endif
 
 
 #endif /* PORT_REGS_H_ */
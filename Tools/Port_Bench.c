@@ -0,0 +1,1083 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Bench.c
+ *
+ * Description: Host benchmark of the Port Driver register accesses. Drives every Port API over
+ *              the shipped configuration and a synthetic configuration on the register model of
+ *              Port_Sim.c, reports bus loads, bus stores, modelled bus cycles, host branches and host
+ *              time per call and fails when an API exceeds its budget in Port_Bench_Budget.h.
+ *
+ *              Build (from Tools):
+ *                cc -pthread -DPORT_HOST_SIMULATION=STD_ON -DPORT_CFGGEN_NO_MAIN -I.. -I. -I<AUTOSAR include path> \
+ *                   Port_Bench.c Port_Sim.c Port_CfgGen.c ../Port.c ../Port_PBcfg.c <Det.c> -o Port_Bench
+ *              Synthetic configurations of another size (8 to 39 pins, the device has 39 non JTAG
+ *              pins) are benchmarked by adding -DPORT_CONFIGURED_PINS=<n> and leaving out Port_PBcfg.c.
+ *              Adding -DPORT_AHB_APERTURE=STD_ON also runs every configuration with all of its ports on
+ *              the AHB aperture, reported with an _AHB suffix, to compare the bus cycles of both paths.
+ *              A stress test then runs the reentrant services from several threads on the pins of one
+ *              port, with Port_RefreshPortDirection repairing a drifted pin of that port from another
+ *              thread, and counts the lost updates, it fails when PORT_ATOMIC_ACCESS or PORT_EXCLUSIVE_AREAS
+ *              is enabled and any update is lost. Every register access of the stress test yields the
+ *              processor, so the build with neither of them and without PORT_BITBAND_ACCESS must lose
+ *              updates, or the test fails as unable to detect them. The bench defines the SchM exclusive
+ *              area with a mutex.
+ *              With -DPORT_TRACE=STD_ON the trace ring buffer is written to Port_Trace.bin before the
+ *              stress test, to be decoded by Port_TraceDump.
+ *
+ * Author: Mazen Hekal
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#include "Port.h"
+#include "Port_Regs.h"
+#include "Port_Sim.h"
+#include "Port_CfgGen.h"
+#if (PORT_EXCLUSIVE_AREAS == STD_ON)
+#include "SchM_Port.h"
+#endif
+
+/* Number of pins of the shipped configuration in Port_PBcfg.c */
+#define BENCH_SHIPPED_PINS      (39U)
+
+/* Number of times every measured call sequence is repeated */
+#define BENCH_REPEAT            (200U)
+
+/* Threads of the stress test and calls of every thread, and refreshes between two yields of the refresh thread */
+#define BENCH_STRESS_THREADS    (4U)
+#define BENCH_STRESS_CALLS      (20000U)
+#define BENCH_STRESS_REFRESH    (64U)
+
+/* Structure Type to hold the budget of one API over one configuration */
+typedef struct
+{
+	const char * Config;
+	const char * Api;
+	uint32 MaxLoads;
+	uint32 MaxStores;
+}Bench_BudgetType;
+
+#include "Port_Bench_Budget.h"
+
+/* Structure Type to hold the measurements of one API over one configuration */
+typedef struct
+{
+	const char * Api;
+	uint32 Calls;
+	uint32 MaxLoads;
+	uint32 MaxStores;
+	uint64_t TotalLoads;
+	uint64_t TotalStores;
+	uint64_t TotalCycles;
+	uint64_t Branches;
+	uint64_t Nanoseconds;
+}Bench_ResultType;
+
+/* Structure Type to hold one thread of the stress test and the pins it owns */
+typedef struct
+{
+	pthread_t Thread;
+	Port_PinType Pins[8];
+	uint8 NumberOfPins;
+	uint8 Directions;      /* Last direction written to every owned pin, one bit per pin number */
+	uint32 Lost;
+}Bench_StressType;
+
+/* Configuration the measured calls run on */
+static const Port_ConfigType * Bench_ConfigPtr;
+static Port_ConfigType Bench_Synthetic;
+#if (PORT_AHB_APERTURE == STD_ON)
+static Port_ConfigType Bench_Ahb;
+#endif
+
+/* Variant of the configuration Port_SwitchConfiguration switches to and back from */
+static Port_ConfigType Bench_Variant;
+
+/* Host branch counter, -1 when the kernel does not provide it */
+static int Bench_BranchFd = -1;
+
+/* Number of budget violations found */
+static uint32 Bench_Failures;
+
+/* Results of the query services, kept so the calls are not optimized out */
+volatile uint32 Bench_Sink;
+
+/* Modes supported by every pin, the alternate functions and analog mode Port_SetPinMode is measured with */
+static const uint16 Bench_PinModes[PORT_NUMBER_OF_PORTS][PORT_PINS_PER_PORT] =
+{
+	PORT_PIN_MODES_TABLE(PORT_PIN_MODES_INITIALIZER, 0, 0)
+};
+
+/* GPIODIR and GPIODEN of the port the stress test runs on */
+static uint32 Bench_StressDir;
+static uint32 Bench_StressDen;
+
+/* Pin of the stress port with a fixed direction the refresh thread drifts, its configured
+ * direction bit, and the flag that stops the refresh thread once the other threads are done */
+static uint8 Bench_StressFixedBit;
+static uint32 Bench_StressFixedDir;
+static boolean Bench_StressDone;
+static uint32 Bench_StressDrifts;
+static uint32 Bench_StressMissed;
+
+#if (PORT_EXCLUSIVE_AREAS == STD_ON)
+/* Exclusive area of the Port Driver, provided by the SchM on the device */
+static pthread_mutex_t Bench_ExclusiveArea = PTHREAD_MUTEX_INITIALIZER;
+
+void SchM_Enter_Port_PORT_EXCLUSIVE_AREA_0(void)
+{
+	pthread_mutex_lock(&Bench_ExclusiveArea);
+}
+
+void SchM_Exit_Port_PORT_EXCLUSIVE_AREA_0(void)
+{
+	pthread_mutex_unlock(&Bench_ExclusiveArea);
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Bench_OpenBranchCounter
+ * Description: Opens the user space branch instruction counter of this thread
+ ************************************************************************************/
+static void Bench_OpenBranchCounter(void)
+{
+	struct perf_event_attr attr;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.config = PERF_COUNT_HW_BRANCH_INSTRUCTIONS;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	Bench_BranchFd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+	if(Bench_BranchFd >= 0)
+	{
+		ioctl(Bench_BranchFd, PERF_EVENT_IOC_ENABLE, 0);
+	}
+}
+
+static uint64_t Bench_ReadBranches(void)
+{
+	uint64_t value = 0;
+
+	if((Bench_BranchFd < 0) || (read(Bench_BranchFd, &value, sizeof(value)) != (ssize_t)sizeof(value)))
+	{
+		return 0;
+	}
+	return value;
+}
+
+static uint64_t Bench_Now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+/************************************************************************************
+ * Function Name: Bench_BuildSynthetic
+ * Description: Builds a configuration of PORT_CONFIGURED_PINS pins taken round robin over
+ *              the ports, alternating pulled up inputs and outputs driven low, every
+ *              fourth pin with a direction fixed for Port_RefreshPortDirection. In the
+ *              safe state the outputs stay driven low and the inputs are disabled
+ ************************************************************************************/
+static void Bench_BuildSynthetic(Port_ConfigType * Config)
+{
+	static const uint8 FirstPin[PORT_NUMBER_OF_PORTS] = { 0, 0, 4, 0, 0, 0 };
+	static const uint8 LastPin[PORT_NUMBER_OF_PORTS] = { 7, 7, 7, 7, 5, 4 };
+	uint8 next[PORT_NUMBER_OF_PORTS];
+	uint8 count = 0;
+
+	memset(Config, 0, sizeof(*Config));
+	memcpy(next, FirstPin, sizeof(next));
+	while(count < PORT_CONFIGURED_PINS)
+	{
+		for(uint8 port = 0; (port < PORT_NUMBER_OF_PORTS) && (count < PORT_CONFIGURED_PINS); port++)
+		{
+			Port_ConfigPin * pin = &Config->Pins[count];
+			Port_ConfigPin safe;
+			if(next[port] > LastPin[port])
+			{
+				continue;
+			}
+			pin->port_Num = port;
+			pin->pin_Num = next[port]++;
+			pin->pin_Direction = (count & 1U) ? PORT_PIN_OUT : PORT_PIN_IN;
+			pin->internal_Resistor = (count & 1U) ? PORT_PIN_OFF : PORT_PIN_PULL_UP;
+			pin->pin_Init_Value = STD_LOW;
+			pin->pin_Mode = PORT_MODE_DIO;
+			pin->pin_Direction_Changeable = ((count % 4U) == 0) ? FALSE : TRUE;
+			pin->pin_Mode_Changeable = TRUE;
+			Config->clock_Mask |= (uint8)(1U << port);
+			CfgGen_FoldPin(&Config->Ports[port], pin);
+			safe = *pin;
+			safe.internal_Resistor = PORT_PIN_OFF;
+			CfgGen_FoldSafe(&Config->Safe[port], &safe);
+			count++;
+		}
+	}
+}
+
+/************************************************************************************
+ * Function Name: Bench_Record
+ * Description: Adds the bus accesses of one call to a result
+ ************************************************************************************/
+static void Bench_Record(Bench_ResultType * Result, Port_Sim_CountType Before)
+{
+	Port_Sim_CountType after = Port_Sim_GetTotal();
+	uint32 loads = after.Loads - Before.Loads;
+	uint32 stores = after.Stores - Before.Stores;
+
+	Result->Calls++;
+	Result->TotalLoads += loads;
+	Result->TotalStores += stores;
+	Result->TotalCycles += after.Cycles - Before.Cycles;
+	Result->MaxLoads = (loads > Result->MaxLoads) ? loads : Result->MaxLoads;
+	Result->MaxStores = (stores > Result->MaxStores) ? stores : Result->MaxStores;
+}
+
+/* APB base addresses of the ports, used to make a pin drift behind the driver */
+static const uint32 Bench_PortBase[PORT_NUMBER_OF_PORTS] =
+{
+	GPIO_PORTA_BASE_ADDRESS, GPIO_PORTB_BASE_ADDRESS, GPIO_PORTC_BASE_ADDRESS,
+	GPIO_PORTD_BASE_ADDRESS, GPIO_PORTE_BASE_ADDRESS, GPIO_PORTF_BASE_ADDRESS
+};
+
+/* Measured call sequences, one call of the API per pin where the API takes a pin.
+ * The pins with a fixed direction are left out of the direction changes */
+static void Bench_Init(Bench_ResultType * Result)
+{
+	Port_Sim_CountType before = Port_Sim_GetTotal();
+	Port_Init(Bench_ConfigPtr);
+	Bench_Record(Result, before);
+}
+
+static void Bench_SetPinDirection(Bench_ResultType * Result)
+{
+	for(Port_PinType pin = 0; pin < PORT_CONFIGURED_PINS; pin++)
+	{
+		if(Bench_ConfigPtr->Pins[pin].pin_Direction_Changeable == TRUE)
+		{
+			Port_Sim_CountType before = Port_Sim_GetTotal();
+			Port_SetPinDirection(pin, (Port_PinDirection)((Result->Calls + pin) & 1U));
+			Bench_Record(Result, before);
+		}
+	}
+}
+
+/* Every pin with a changeable mode goes to its first alternate function and to analog mode when it
+ * supports them, and back to its configured mode after each, so every call is one mode transition */
+static void Bench_SetPinMode(Bench_ResultType * Result)
+{
+	for(Port_PinType pin = 0; pin < PORT_CONFIGURED_PINS; pin++)
+	{
+		const Port_ConfigPin * Pin = &Bench_ConfigPtr->Pins[pin];
+		uint16 modes = Bench_PinModes[Pin->port_Num][Pin->pin_Num];
+		Port_PinModeType targets[2] = { PORT_MODE_ALT01, PORT_MODE_ANALOG };
+
+		if(Pin->pin_Mode_Changeable == FALSE)
+		{
+			continue;
+		}
+		while((targets[0] < PORT_MODE_ALT14) && ((modes & PORT_MODE_BIT(targets[0])) == 0))
+		{
+			targets[0]++;
+		}
+		for(uint8 target = 0; target < 2; target++)
+		{
+			Port_Sim_CountType before;
+			if(((modes & PORT_MODE_BIT(targets[target])) == 0) || (targets[target] == Pin->pin_Mode))
+			{
+				continue;
+			}
+			before = Port_Sim_GetTotal();
+			Port_SetPinMode(pin, targets[target]);
+			Bench_Record(Result, before);
+			before = Port_Sim_GetTotal();
+			Port_SetPinMode(pin, Pin->pin_Mode);
+			Bench_Record(Result, before);
+		}
+	}
+}
+
+static void Bench_WritePin(Bench_ResultType * Result)
+{
+	for(Port_PinType pin = 0; pin < PORT_CONFIGURED_PINS; pin++)
+	{
+		Port_Sim_CountType before = Port_Sim_GetTotal();
+		Port_WritePin(pin, (uint8)((Result->Calls + pin) & 1U));
+		Bench_Record(Result, before);
+	}
+}
+
+static void Bench_SetPinPad(Bench_ResultType * Result)
+{
+	uint32 pad_Pins = 0;
+	boolean enable;
+
+	/* Pins in analog mode take no pad setting */
+	for(Port_PinType pin = 0; pin < PORT_CONFIGURED_PINS; pin++)
+	{
+		pad_Pins += (Bench_ConfigPtr->Pins[pin].pin_Mode != PORT_MODE_ANALOG) ? 1U : 0U;
+	}
+	if(pad_Pins == 0)
+	{
+		return;
+	}
+	/* Every other sequence selects the 8-mA open drain output with slew rate control, the others go back to the
+	 * reset pad state. The slew rate control needs the 8-mA drive, so it is enabled after it and disabled before */
+	enable = (((Result->Calls / (3U * pad_Pins)) & 1U) == 0) ? TRUE : FALSE;
+	for(Port_PinType pin = 0; pin < PORT_CONFIGURED_PINS; pin++)
+	{
+		Port_Sim_CountType before;
+
+		if(Bench_ConfigPtr->Pins[pin].pin_Mode == PORT_MODE_ANALOG)
+		{
+			continue;
+		}
+		if(enable == FALSE)
+		{
+			before = Port_Sim_GetTotal();
+			Port_SetPinSlewRate(pin, FALSE);
+			Bench_Record(Result, before);
+		}
+		before = Port_Sim_GetTotal();
+		Port_SetPinDriveStrength(pin, (enable == TRUE) ? PORT_PIN_DRIVE_8MA : PORT_PIN_DRIVE_2MA);
+		Bench_Record(Result, before);
+		if(enable == TRUE)
+		{
+			before = Port_Sim_GetTotal();
+			Port_SetPinSlewRate(pin, TRUE);
+			Bench_Record(Result, before);
+		}
+		before = Port_Sim_GetTotal();
+		Port_SetPinOpenDrain(pin, enable);
+		Bench_Record(Result, before);
+	}
+}
+
+static void Bench_SetPinGroup(Bench_ResultType * Result)
+{
+	static Port_PinChangeType changes[PORT_CONFIGURED_PINS];
+	Port_Sim_CountType before;
+
+	for(Port_PinType pin = 0; pin < PORT_CONFIGURED_PINS; pin++)
+	{
+		changes[pin].pin = pin;
+		changes[pin].change_Mask = (Bench_ConfigPtr->Pins[pin].pin_Direction_Changeable == TRUE) ?
+				(PORT_CHANGE_DIRECTION | PORT_CHANGE_MODE) : PORT_CHANGE_MODE;
+		changes[pin].pin_Direction = (Port_PinDirection)((Result->Calls + pin) & 1U);
+		changes[pin].pin_Mode = PORT_MODE_DIO;
+	}
+	before = Port_Sim_GetTotal();
+	Port_SetPinGroup(changes, PORT_CONFIGURED_PINS);
+	Bench_Record(Result, before);
+}
+
+static void Bench_CommitUpdate(Bench_ResultType * Result)
+{
+	Port_Sim_CountType before = Port_Sim_GetTotal();
+
+	Port_BeginUpdate();
+	for(Port_PinType pin = 0; pin < PORT_CONFIGURED_PINS; pin++)
+	{
+		if(Bench_ConfigPtr->Pins[pin].pin_Direction_Changeable == TRUE)
+		{
+			Port_SetPinDirection(pin, (Port_PinDirection)((Result->Calls + pin) & 1U));
+		}
+		Port_SetPinMode(pin, PORT_MODE_DIO);
+		Port_WritePin(pin, (uint8)((Result->Calls + pin) & 1U));
+	}
+	Port_CommitUpdate();
+	Bench_Record(Result, before);
+}
+
+static void Bench_GetPinState(Bench_ResultType * Result)
+{
+	static Port_PortSnapshotType snapshot;
+
+	for(Port_PinType pin = 0; pin < PORT_CONFIGURED_PINS; pin++)
+	{
+		Port_Sim_CountType before = Port_Sim_GetTotal();
+		Bench_Sink += Port_GetPinDirection(pin) + Port_GetPinMode(pin);
+		Port_GetPortSnapshot((Port_PortType)(pin % PORT_NUMBER_OF_PORTS), &snapshot);
+		Bench_Record(Result, before);
+	}
+}
+
+static void Bench_VerifyConfiguration(Bench_ResultType * Result)
+{
+	static Port_VerifyResultType verify;
+	Port_Sim_CountType before = Port_Sim_GetTotal();
+
+	if(Port_VerifyConfiguration(&verify) != E_OK)
+	{
+		printf("  FAIL: Port_VerifyConfiguration found mismatching registers\n");
+		Bench_Failures++;
+	}
+	Bench_Record(Result, before);
+}
+
+/************************************************************************************
+ * Function Name: Bench_BuildVariant
+ * Description: Builds a variant of a configuration that differs in three pins: the first
+ *              two switch direction and the third switches its internal resistor
+ ************************************************************************************/
+static void Bench_BuildVariant(Port_ConfigType * Variant, const Port_ConfigType * Config)
+{
+	*Variant = *Config;
+	for(Port_PinType pin = 0; pin < 3; pin++)
+	{
+		Port_ConfigPin * Pin = &Variant->Pins[pin];
+		if(pin < 2)
+		{
+			Pin->pin_Direction = (Pin->pin_Direction == PORT_PIN_OUT) ? PORT_PIN_IN : PORT_PIN_OUT;
+		}
+		else
+		{
+			Pin->internal_Resistor = (Pin->internal_Resistor == PORT_PIN_PULL_UP) ? PORT_PIN_PULL_DOWN : PORT_PIN_PULL_UP;
+		}
+	}
+	memset(Variant->Ports, 0, sizeof(Variant->Ports));
+	for(Port_PinType pin = 0; pin < PORT_CONFIGURED_PINS; pin++)
+	{
+		CfgGen_FoldPin(&Variant->Ports[Variant->Pins[pin].port_Num], &Variant->Pins[pin]);
+	}
+}
+
+static void Bench_SwitchConfiguration(Bench_ResultType * Result)
+{
+	static Port_VerifyResultType verify;
+	Port_Sim_CountType before = Port_Sim_GetTotal();
+	Port_SwitchConfiguration(&Bench_Variant);
+	Bench_Record(Result, before);
+
+	before = Port_Sim_GetTotal();
+	Port_SwitchConfiguration(Bench_ConfigPtr);
+	Bench_Record(Result, before);
+
+	/* The registers must match the configuration switched back to */
+	if(Port_VerifyConfiguration(&verify) != E_OK)
+	{
+		printf("  FAIL: Port_VerifyConfiguration found mismatching registers after Port_SwitchConfiguration\n");
+		Bench_Failures++;
+	}
+}
+
+static void Bench_EnterSafeState(Bench_ResultType * Result)
+{
+	static Port_VerifyResultType verify;
+	Port_Sim_CountType before = Port_Sim_GetTotal();
+	Port_EnterSafeState();
+	Bench_Record(Result, before);
+
+	/* The registers must match the safe state image of the configuration */
+	if(Port_VerifyConfiguration(&verify) != E_OK)
+	{
+		printf("  FAIL: Port_VerifyConfiguration found mismatching registers in the safe state\n");
+		Bench_Failures++;
+	}
+	Port_RestoreState();
+}
+
+static void Bench_RestoreState(Bench_ResultType * Result)
+{
+	static Port_VerifyResultType verify;
+	Port_Sim_CountType before;
+
+	Port_EnterSafeState();
+	before = Port_Sim_GetTotal();
+	Port_RestoreState();
+	Bench_Record(Result, before);
+
+	/* The registers must match the configuration again */
+	if(Port_VerifyConfiguration(&verify) != E_OK)
+	{
+		printf("  FAIL: Port_VerifyConfiguration found mismatching registers after Port_RestoreState\n");
+		Bench_Failures++;
+	}
+}
+
+static void Bench_RefreshPortDirection(Bench_ResultType * Result)
+{
+	Port_Sim_CountType before;
+
+	/* Every other refresh, flip the direction of the first pin with a fixed direction */
+	for(Port_PinType pin = 0; (pin < PORT_CONFIGURED_PINS) && ((Result->Calls & 1U) != 0); pin++)
+	{
+		const Port_ConfigPin * Pin = &Bench_ConfigPtr->Pins[pin];
+		if(Pin->pin_Direction_Changeable == FALSE)
+		{
+			uint32 dir_Address = Bench_PortBase[Pin->port_Num] + PORT_DIR_REG_OFFSET;
+			Port_Sim_Poke(dir_Address, Port_Sim_Peek(dir_Address) ^ (1U << Pin->pin_Num));
+			break;
+		}
+	}
+	before = Port_Sim_GetTotal();
+	Port_RefreshPortDirection();
+	Bench_Record(Result, before);
+}
+
+/************************************************************************************
+ * Function Name: Bench_Run
+ * Description: Repeats one call sequence, measures it and checks it against its budget
+ ************************************************************************************/
+static void Bench_Run(const char * Config, const char * Budget, const char * Api, void (*Sequence)(Bench_ResultType *))
+{
+	Bench_ResultType result;
+	uint64_t branches;
+	uint64_t start;
+	const Bench_BudgetType * budget = NULL;
+
+	memset(&result, 0, sizeof(result));
+	result.Api = Api;
+	branches = Bench_ReadBranches();
+	start = Bench_Now();
+	for(uint32 i = 0; i < BENCH_REPEAT; i++)
+	{
+		Sequence(&result);
+	}
+	result.Nanoseconds = Bench_Now() - start;
+	result.Branches = Bench_ReadBranches() - branches;
+
+	printf("%-24s %-28s %7lu %9.2f %9lu %9.2f %9lu %9.2f %10.1f %9.1f\n", Config, Api, (unsigned long)result.Calls,
+			(double)result.TotalLoads / result.Calls, (unsigned long)result.MaxLoads,
+			(double)result.TotalStores / result.Calls, (unsigned long)result.MaxStores,
+			(double)result.TotalCycles / result.Calls,
+			(Bench_BranchFd >= 0) ? (double)result.Branches / result.Calls : -1.0,
+			(double)result.Nanoseconds / result.Calls);
+
+	for(uint32 i = 0; i < (sizeof(Bench_Budgets) / sizeof(Bench_Budgets[0])); i++)
+	{
+		if((strcmp(Bench_Budgets[i].Config, Budget) == 0) && (strcmp(Bench_Budgets[i].Api, Api) == 0))
+		{
+			budget = &Bench_Budgets[i];
+		}
+	}
+	if(budget == NULL)
+	{
+		printf("  no budget for %s on %s\n", Api, Config);
+	}
+	else if((result.MaxLoads > budget->MaxLoads) || (result.MaxStores > budget->MaxStores))
+	{
+		printf("  FAIL: %s on %s exceeds its budget of %lu loads and %lu stores per call\n", Api, Config,
+				(unsigned long)budget->MaxLoads, (unsigned long)budget->MaxStores);
+		Bench_Failures++;
+	}
+}
+
+/************************************************************************************
+ * Function Name: Bench_CheckSweeps
+ * Description: Checks that Calls refreshes completed the sweeps the round robin refresh
+ *              guarantees over the ports with pins of a fixed direction
+ ************************************************************************************/
+static void Bench_CheckSweeps(const char * Name, uint32 Sweeps, uint32 Calls)
+{
+	uint8 fixed_Ports = 0;
+	uint32 ports = 0;
+	uint32 expected = 0;
+
+	for(Port_PinType pin = 0; pin < PORT_CONFIGURED_PINS; pin++)
+	{
+		if(Bench_ConfigPtr->Pins[pin].pin_Direction_Changeable == FALSE)
+		{
+			fixed_Ports |= (uint8)(1U << Bench_ConfigPtr->Pins[pin].port_Num);
+		}
+	}
+	for(uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+	{
+		ports += (fixed_Ports >> port) & 1U;
+	}
+	if(ports != 0)
+	{
+		expected = (Calls * ((ports < PORT_REFRESH_PORTS_PER_CALL) ? ports : PORT_REFRESH_PORTS_PER_CALL)) / ports;
+	}
+	if(Sweeps != expected)
+	{
+		printf("  FAIL: %lu refresh sweeps on %s, expected %lu\n", (unsigned long)Sweeps, Name, (unsigned long)expected);
+		Bench_Failures++;
+	}
+}
+
+/************************************************************************************
+ * Function Name: Bench_CheckRepair
+ * Description: Drifts a pin with a changeable direction and a pin with a fixed direction
+ *              of one port together, and checks that a refresh sweep repairs the fixed pin
+ *              only and that Port_VerifyConfiguration still reports the changeable pin
+ ************************************************************************************/
+static void Bench_CheckRepair(const char * Name)
+{
+	Port_PinType fixed = PORT_CONFIGURED_PINS;
+	Port_PinType changeable = PORT_CONFIGURED_PINS;
+	static Port_VerifyResultType verify;
+
+	for(Port_PinType pin = 0; (pin < PORT_CONFIGURED_PINS) && (changeable == PORT_CONFIGURED_PINS); pin++)
+	{
+		if(Bench_ConfigPtr->Pins[pin].pin_Direction_Changeable == FALSE)
+		{
+			continue;
+		}
+		for(Port_PinType other = 0; other < PORT_CONFIGURED_PINS; other++)
+		{
+			if((Bench_ConfigPtr->Pins[other].pin_Direction_Changeable == FALSE)
+					&& (Bench_ConfigPtr->Pins[other].port_Num == Bench_ConfigPtr->Pins[pin].port_Num))
+			{
+				fixed = other;
+				changeable = pin;
+				break;
+			}
+		}
+	}
+	if(changeable != PORT_CONFIGURED_PINS)
+	{
+		uint8 port = Bench_ConfigPtr->Pins[changeable].port_Num;
+		uint32 dir_Address = Bench_PortBase[port] + PORT_DIR_REG_OFFSET;
+		uint32 dir_Value = Port_Sim_Peek(dir_Address);
+		uint32 fixed_Bit = 1U << Bench_ConfigPtr->Pins[fixed].pin_Num;
+		uint32 changeable_Bit = 1U << Bench_ConfigPtr->Pins[changeable].pin_Num;
+
+		Port_Sim_Poke(dir_Address, dir_Value ^ fixed_Bit ^ changeable_Bit);
+		for(uint8 call = 0; call < PORT_NUMBER_OF_PORTS; call++)
+		{
+			Port_RefreshPortDirection();
+		}
+		if(((Port_Sim_Peek(dir_Address) ^ dir_Value) & fixed_Bit) != 0)
+		{
+			printf("  FAIL: a refresh sweep leaves the drifted pin %u on %s\n", (unsigned)fixed, Name);
+			Bench_Failures++;
+		}
+		if(((Port_Sim_Peek(dir_Address) ^ dir_Value) & changeable_Bit) == 0)
+		{
+			printf("  FAIL: a refresh sweep overwrites the changeable pin %u on %s\n", (unsigned)changeable, Name);
+			Bench_Failures++;
+		}
+		if((Port_VerifyConfiguration(&verify) == E_OK) || ((verify.mismatch_Mask[port] & (1U << PORT_IMAGE_DIR)) == 0))
+		{
+			printf("  FAIL: Port_VerifyConfiguration misses the drift of pin %u on %s\n", (unsigned)changeable, Name);
+			Bench_Failures++;
+		}
+		Port_Sim_Poke(dir_Address, dir_Value);
+	}
+}
+
+#if (PORT_DEV_ERROR_DETECT == STD_OFF)
+/************************************************************************************
+ * Function Name: Bench_CheckStrayWrite
+ * Description: Changes the direction of a pin configured with a fixed direction through
+ *              Port_SetPinDirection, which only the development error detection rejects,
+ *              and checks that Port_VerifyConfiguration reports the register although the
+ *              shadow holds the value written
+ ************************************************************************************/
+static void Bench_CheckStrayWrite(const char * Name)
+{
+	static Port_VerifyResultType verify;
+
+	for(Port_PinType pin = 0; pin < PORT_CONFIGURED_PINS; pin++)
+	{
+		const Port_ConfigPin * Pin = &Bench_ConfigPtr->Pins[pin];
+		Port_PinDirection direction = Port_GetPinDirection(pin);
+
+		if(Pin->pin_Direction_Changeable == TRUE)
+		{
+			continue;
+		}
+		Port_SetPinDirection(pin, (direction == PORT_PIN_OUT) ? PORT_PIN_IN : PORT_PIN_OUT);
+		if((Port_VerifyConfiguration(&verify) == E_OK)
+				|| ((verify.mismatch_Mask[Pin->port_Num] & (1U << PORT_IMAGE_DIR)) == 0))
+		{
+			printf("  FAIL: Port_VerifyConfiguration misses the stray direction of pin %u on %s\n", (unsigned)pin, Name);
+			Bench_Failures++;
+		}
+		Port_SetPinDirection(pin, direction);
+		break;
+	}
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Bench_CheckPads
+ * Description: Checks that Port_SwitchConfiguration and Port_Init take a pin with the
+ *              reset pad settings back to them after they were changed at runtime
+ ************************************************************************************/
+static void Bench_CheckPads(const char * Name)
+{
+	static const char * const Api[2] = { "Port_SwitchConfiguration", "Port_Init" };
+
+	for(Port_PinType pin = 0; pin < PORT_CONFIGURED_PINS; pin++)
+	{
+		const Port_ConfigPin * Pin = &Bench_ConfigPtr->Pins[pin];
+		uint32 base = Bench_PortBase[Pin->port_Num];
+		uint32 pin_Mask = 1U << Pin->pin_Num;
+
+		if((Pin->drive_Strength != PORT_PIN_DRIVE_2MA) || (Pin->slew_Rate_Control == TRUE) || (Pin->open_Drain == TRUE)
+				|| (Pin->pin_Mode == PORT_MODE_ANALOG))
+		{
+			continue;
+		}
+		for(uint8 api = 0; api < 2; api++)
+		{
+			Port_SetPinDriveStrength(pin, PORT_PIN_DRIVE_8MA);
+			Port_SetPinSlewRate(pin, TRUE);
+			Port_SetPinOpenDrain(pin, TRUE);
+			if(api == 0)
+			{
+				Port_SwitchConfiguration(Bench_ConfigPtr);
+			}
+			else
+			{
+				Port_Init(Bench_ConfigPtr);
+			}
+			if(((Port_Sim_Peek(base + PORT_DRIVE_2MA_REG_OFFSET) & pin_Mask) == 0)
+					|| ((Port_Sim_Peek(base + PORT_DRIVE_8MA_REG_OFFSET) & pin_Mask) != 0)
+					|| ((Port_Sim_Peek(base + PORT_SLEW_RATE_REG_OFFSET) & pin_Mask) != 0)
+					|| ((Port_Sim_Peek(base + PORT_OPEN_DRAIN_REG_OFFSET) & pin_Mask) != 0))
+			{
+				printf("  FAIL: %s leaves a runtime pad setting of pin %u on %s\n", Api[api], (unsigned)pin, Name);
+				Bench_Failures++;
+			}
+		}
+		break;
+	}
+}
+
+/************************************************************************************
+ * Function Name: Bench_ConfigAperture
+ * Description: Benchmarks every Port API over one configuration, checking the calls
+ *              against the budgets of the Budget configuration
+ ************************************************************************************/
+static void Bench_ConfigAperture(const char * Name, const char * Budget, const Port_ConfigType * Config)
+{
+	uint32 sweeps;
+	Port_Sim_ClockType clocks;
+
+	Bench_ConfigPtr = Config;
+	Port_Sim_Reset();
+	Bench_Run(Name, Budget, "Port_Init", Bench_Init);
+	Bench_Run(Name, Budget, "Port_SetPinDirection", Bench_SetPinDirection);
+	Bench_Run(Name, Budget, "Port_SetPinMode", Bench_SetPinMode);
+	sweeps = Port_GetSweepCount();
+	Bench_Run(Name, Budget, "Port_RefreshPortDirection", Bench_RefreshPortDirection);
+	Bench_CheckSweeps(Name, Port_GetSweepCount() - sweeps, BENCH_REPEAT);
+	Bench_CheckRepair(Name);
+	Bench_Run(Name, Budget, "Port_WritePin", Bench_WritePin);
+	Bench_Run(Name, Budget, "Port_SetPinPad", Bench_SetPinPad);
+	Bench_CheckPads(Name);
+	Bench_Run(Name, Budget, "Port_SetPinGroup", Bench_SetPinGroup);
+	Bench_Run(Name, Budget, "Port_CommitUpdate", Bench_CommitUpdate);
+	Bench_Run(Name, Budget, "Port_GetPinState", Bench_GetPinState);
+	Bench_Run(Name, Budget, "Port_VerifyConfiguration", Bench_VerifyConfiguration);
+#if (PORT_DEV_ERROR_DETECT == STD_OFF)
+	Bench_CheckStrayWrite(Name);
+#endif
+	Bench_BuildVariant(&Bench_Variant, Config);
+	Port_SwitchConfiguration(Config);   /* Undo the changes of the previous sequences, so only the variant pins differ */
+	Bench_Run(Name, Budget, "Port_SwitchConfiguration", Bench_SwitchConfiguration);
+	Bench_Run(Name, Budget, "Port_EnterSafeState", Bench_EnterSafeState);
+	Bench_Run(Name, Budget, "Port_RestoreState", Bench_RestoreState);
+	clocks = Port_Sim_GetClocks();
+	printf("  RCGC2 writes %lu: %lu port clocks enabled, %lu port clocks gated\n", (unsigned long)clocks.Writes,
+			(unsigned long)clocks.Enables, (unsigned long)clocks.Gates);
+	if(Port_Sim_GetFaults() != 0)
+	{
+		printf("  FAIL: %lu bus faults on %s\n", (unsigned long)Port_Sim_GetFaults(), Name);
+		Bench_Failures++;
+	}
+}
+
+/************************************************************************************
+ * Function Name: Bench_Config
+ * Description: Benchmarks one configuration as it is and, when the AHB aperture is
+ *              enabled, again with all of its used ports on the AHB aperture
+ ************************************************************************************/
+static void Bench_Config(const char * Name, const Port_ConfigType * Config)
+{
+	Bench_ConfigAperture(Name, Name, Config);
+#if (PORT_AHB_APERTURE == STD_ON)
+	{
+		char name[32];
+		Bench_Ahb = *Config;
+		Bench_Ahb.ahb_Mask = Config->clock_Mask;
+		snprintf(name, sizeof(name), "%s_AHB", Name);
+		Bench_ConfigAperture(name, Name, &Bench_Ahb);  /* The aperture does not change the number of accesses */
+	}
+#endif
+}
+
+/************************************************************************************
+ * Function Name: Bench_StressThread
+ * Description: Flips the direction of the pins of one thread and sets their mode, and
+ *              checks after every call that GPIODIR and GPIODEN hold what the thread wrote
+ *              to its pins, which no other thread touches. A pin another thread overwrote is
+ *              counted once, when the check first finds it wrong
+ ************************************************************************************/
+static void * Bench_StressThread(void * Arg)
+{
+	Bench_StressType * Stress = (Bench_StressType *)Arg;
+	uint32 written_Mask = 0;
+	uint32 wrong_Mask = 0;
+
+	for(uint32 i = 0; i < BENCH_STRESS_CALLS; i++)
+	{
+		Port_PinType pin = Stress->Pins[i % Stress->NumberOfPins];
+		uint8 pin_Num = Bench_ConfigPtr->Pins[pin].pin_Num;
+		Port_PinDirection direction = (Port_PinDirection)((i / Stress->NumberOfPins) & 1U);
+		uint32 found_Mask;
+
+		Port_SetPinDirection(pin, direction);
+		Port_SetPinMode(pin, PORT_MODE_DIO);
+		Stress->Directions = (uint8)((Stress->Directions & ~(1U << pin_Num)) | ((uint32)direction << pin_Num));
+		written_Mask |= 1U << pin_Num;
+		/* The other threads finish the stores they computed meanwhile, a stale one overwrites this pin */
+		sched_yield();
+		found_Mask = ((Port_Sim_Peek(Bench_StressDir) ^ Stress->Directions) | ~Port_Sim_Peek(Bench_StressDen)) & written_Mask;
+		for(uint32 wrong = found_Mask & ~wrong_Mask; wrong != 0; wrong &= wrong - 1U)
+		{
+			Stress->Lost++;
+		}
+		wrong_Mask = found_Mask;
+	}
+	return NULL;
+}
+
+/************************************************************************************
+ * Function Name: Bench_StressRefresh
+ * Description: Drifts the pin with a fixed direction of the stress port, as a disturbed
+ *              GPIODIR would, and runs Port_RefreshPortDirection over every port while the
+ *              other threads change the directions of their pins. Counts the drifts that are
+ *              not repaired, the lost updates of the other pins are found by their own checks
+ ************************************************************************************/
+static void * Bench_StressRefresh(void * Arg)
+{
+	(void)Arg;
+	while(__atomic_load_n(&Bench_StressDone, __ATOMIC_ACQUIRE) == FALSE)
+	{
+		if(Bench_StressFixedBit != 0)
+		{
+			/* The drift is applied atomically, it must not lose a store of the other threads */
+			uint32 dir_Value = Port_Sim_Peek(Bench_StressDir);
+			while(Port_Sim_CompareExchange(Bench_StressDir, &dir_Value, dir_Value ^ Bench_StressFixedBit) == FALSE)
+			{
+				/* Another thread changed GPIODIR, retry from the value it left */
+			}
+		}
+		for(uint8 call = 0; call < PORT_NUMBER_OF_PORTS; call++)
+		{
+			Port_RefreshPortDirection();
+		}
+		if((Port_Sim_Peek(Bench_StressDir) & Bench_StressFixedBit) != Bench_StressFixedDir)
+		{
+			Bench_StressMissed++;
+		}
+		Bench_StressDrifts++;
+		if((Bench_StressDrifts % BENCH_STRESS_REFRESH) == 0)
+		{
+			/* A refresh runs periodically on the device, the threads changing pins get the processor in between */
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+/************************************************************************************
+ * Function Name: Bench_Stress
+ * Description: Runs the reentrant services concurrently on the changeable pins of the
+ *              port of a configuration with the most of them, spread over the threads,
+ *              while one more thread drifts and refreshes the pin with a fixed direction of
+ *              that port, then checks GPIODIR and its RAM shadow against the last direction
+ *              of every pin. Every register access yields the processor, so the threads
+ *              interleave inside the read-modify-write sequences of the driver, and the build
+ *              without any protection must lose updates
+ ************************************************************************************/
+static void Bench_Stress(const Port_ConfigType * Config)
+{
+	static Bench_StressType stress[BENCH_STRESS_THREADS];
+	pthread_t refresh;
+	uint8 pins_Per_Port[PORT_NUMBER_OF_PORTS] = {0};
+	uint8 port = 0;
+	uint8 fixed_Ports = 0;
+	uint8 pins_Dealt = 0;
+	uint8 pin_Mask = 0;
+	uint8 directions = 0;
+	uint32 lost = 0;
+	uint64_t start;
+	uint64_t nanoseconds;
+	Port_PortSnapshotType snapshot;
+
+	for(Port_PinType pin = 0; pin < PORT_CONFIGURED_PINS; pin++)
+	{
+		if((Config->Pins[pin].pin_Direction_Changeable == TRUE) && (Config->Pins[pin].pin_Mode_Changeable == TRUE))
+		{
+			pins_Per_Port[Config->Pins[pin].port_Num]++;
+		}
+		else if(Config->Pins[pin].pin_Direction_Changeable == FALSE)
+		{
+			fixed_Ports |= (uint8)(1U << Config->Pins[pin].port_Num);
+		}
+	}
+	/* A port with a pin of a fixed direction comes first, so the refresh repairs run on the stress port */
+	for(uint8 other = 0; other < PORT_NUMBER_OF_PORTS; other++)
+	{
+		if((((fixed_Ports >> other) & 1U) > ((fixed_Ports >> port) & 1U))
+				|| ((((fixed_Ports >> other) & 1U) == ((fixed_Ports >> port) & 1U)) && (pins_Per_Port[other] > pins_Per_Port[port])))
+		{
+			port = other;
+		}
+	}
+	memset(stress, 0, sizeof(stress));
+	Bench_StressFixedBit = 0;
+	Bench_StressFixedDir = 0;
+	for(Port_PinType pin = 0; pin < PORT_CONFIGURED_PINS; pin++)
+	{
+		if((Config->Pins[pin].port_Num == port) && (Config->Pins[pin].pin_Direction_Changeable == FALSE)
+				&& (Bench_StressFixedBit == 0))
+		{
+			Bench_StressFixedBit = (uint8)(1U << Config->Pins[pin].pin_Num);
+			Bench_StressFixedDir = (Config->Pins[pin].pin_Direction == PORT_PIN_OUT) ? Bench_StressFixedBit : 0U;
+		}
+		if((Config->Pins[pin].port_Num == port) && (Config->Pins[pin].pin_Direction_Changeable == TRUE)
+				&& (Config->Pins[pin].pin_Mode_Changeable == TRUE))
+		{
+			/* The pins of the port are dealt to the threads in turn, so that two pins already race */
+			Bench_StressType * owner = &stress[pins_Dealt++ % BENCH_STRESS_THREADS];
+			owner->Pins[owner->NumberOfPins++] = pin;
+			pin_Mask |= (uint8)(1U << Config->Pins[pin].pin_Num);
+		}
+	}
+
+	Bench_ConfigPtr = Config;
+	Bench_StressDir = Bench_PortBase[port] + PORT_DIR_REG_OFFSET;
+	Bench_StressDen = Bench_PortBase[port] + PORT_DIGITAL_ENABLE_REG_OFFSET;
+	Port_Sim_Reset();
+	Port_Init(Config);
+	Port_Sim_SetYield(TRUE);
+	Bench_StressDone = FALSE;
+	Bench_StressDrifts = 0;
+	Bench_StressMissed = 0;
+	start = Bench_Now();
+	pthread_create(&refresh, NULL, Bench_StressRefresh, NULL);
+	for(uint8 thread = 0; thread < BENCH_STRESS_THREADS; thread++)
+	{
+		if(stress[thread].NumberOfPins != 0)
+		{
+			pthread_create(&stress[thread].Thread, NULL, Bench_StressThread, &stress[thread]);
+		}
+	}
+	for(uint8 thread = 0; thread < BENCH_STRESS_THREADS; thread++)
+	{
+		if(stress[thread].NumberOfPins != 0)
+		{
+			pthread_join(stress[thread].Thread, NULL);
+			lost += stress[thread].Lost;
+			directions |= stress[thread].Directions;
+		}
+	}
+	__atomic_store_n(&Bench_StressDone, TRUE, __ATOMIC_RELEASE);
+	pthread_join(refresh, NULL);
+	nanoseconds = Bench_Now() - start;
+	Port_Sim_SetYield(FALSE);
+	lost += Bench_StressMissed;
+
+	/* A stale store after the last check of a thread shows up in the final register or in its shadow */
+	Port_GetPortSnapshot(port, &snapshot);
+	for(uint32 wrong = ((Port_Sim_Peek(Bench_StressDir) ^ directions) | (snapshot.dir ^ directions)) & pin_Mask;
+			wrong != 0; wrong &= wrong - 1U)
+	{
+		lost++;
+	}
+	/* A stale store of a refresh shows up as a drifted fixed pin */
+	if((Port_Sim_Peek(Bench_StressDir) & Bench_StressFixedBit) != Bench_StressFixedDir)
+	{
+		lost++;
+	}
+	printf("\nStress: %u threads on %u pins of PORT%c and %lu drift refreshes, %lu lost updates, %.2f million calls per second\n",
+			(unsigned)BENCH_STRESS_THREADS, (unsigned)pins_Per_Port[port], 'A' + port, (unsigned long)Bench_StressDrifts,
+			(unsigned long)lost, (2.0 * BENCH_STRESS_THREADS * BENCH_STRESS_CALLS * 1000.0) / (double)nanoseconds);
+#if ((PORT_ATOMIC_ACCESS == STD_ON) || (PORT_EXCLUSIVE_AREAS == STD_ON))
+	if(lost != 0)
+	{
+		printf("  FAIL: concurrent pin updates were lost\n");
+		Bench_Failures++;
+	}
+#elif (PORT_BITBAND_ACCESS == STD_ON)
+	printf("  PORT_ATOMIC_ACCESS and PORT_EXCLUSIVE_AREAS are STD_OFF, only the single pin alias stores are atomic\n");
+#else
+	/* The stores computed from a stale shadow must be seen, otherwise the check above proves nothing */
+	if(lost == 0)
+	{
+		printf("  FAIL: no lost update found without PORT_ATOMIC_ACCESS or PORT_EXCLUSIVE_AREAS, the stress test misses them\n");
+		Bench_Failures++;
+	}
+	else
+	{
+		printf("  PORT_ATOMIC_ACCESS and PORT_EXCLUSIVE_AREAS are STD_OFF, concurrent updates are not protected\n");
+	}
+#endif
+}
+
+#if (PORT_TRACE == STD_ON)
+/************************************************************************************
+ * Function Name: Bench_DumpTrace
+ * Description: Writes the trace ring buffer as it is in memory, like a debugger dump of Port_Trace
+ ************************************************************************************/
+static void Bench_DumpTrace(const char * FileName)
+{
+	FILE * output = fopen(FileName, "wb");
+
+	if((output == NULL) || (fwrite(&Port_Trace, sizeof(Port_Trace), 1, output) != 1))
+	{
+		perror(FileName);
+		Bench_Failures++;
+	}
+	else
+	{
+		printf("%lu traced calls written to %s\n", (unsigned long)Port_Trace.head, FileName);
+	}
+	if(output != NULL)
+	{
+		fclose(output);
+	}
+}
+#endif
+
+int main(void)
+{
+	char name[24];
+
+	Bench_OpenBranchCounter();
+	printf("Port_ConfigPin %lu bytes, Port_ConfigType %lu bytes: %lu bytes of pins and %lu bytes of port register and safe state images\n\n",
+			(unsigned long)sizeof(Port_ConfigPin), (unsigned long)sizeof(Port_ConfigType),
+			(unsigned long)sizeof(((Port_ConfigType *)0)->Pins),
+			(unsigned long)(sizeof(((Port_ConfigType *)0)->Ports) + sizeof(((Port_ConfigType *)0)->Safe)));
+	printf("%-24s %-28s %7s %9s %9s %9s %9s %9s %10s %9s\n", "configuration", "API", "calls", "loads", "max", "stores",
+			"max", "cycles", "branches", "ns");
+
+#if (PORT_CONFIGURED_PINS == BENCH_SHIPPED_PINS)
+	Bench_Config("Port_Configuration", &Port_Configuration);
+#endif
+	Bench_BuildSynthetic(&Bench_Synthetic);
+	snprintf(name, sizeof(name), "Synthetic_%02u", (unsigned)PORT_CONFIGURED_PINS);
+	Bench_Config(name, &Bench_Synthetic);
+#if (PORT_TRACE == STD_ON)
+	Bench_DumpTrace("Port_Trace.bin");
+#endif
+	Bench_Stress(&Bench_Synthetic);
+
+	if(Bench_BranchFd < 0)
+	{
+		printf("host branch counter not available, branches reported as -1\n");
+	}
+	printf("%s: %lu budget violation(s)\n", (Bench_Failures == 0) ? "PASS" : "FAIL", (unsigned long)Bench_Failures);
+	return (Bench_Failures == 0) ? 0 : 1;
+}
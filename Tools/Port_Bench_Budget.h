@@ -0,0 +1,143 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Bench_Budget.h
+ *
+ * Description: Bus access budgets of the Port Driver APIs checked by Port_Bench.c.
+ *              Maximum loads and stores of a single call, per configuration and API.
+ *
+ * Author: Mazen Hekal
+ ******************************************************************************/
+
+#ifndef PORT_BENCH_BUDGET_H
+#define PORT_BENCH_BUDGET_H
+
+/* Port_Init switches GPIOHBCTL with one more read-modify-write when the AHB aperture is enabled */
+#if (PORT_AHB_APERTURE == STD_ON)
+#define BENCH_APERTURE_SWITCH   (1U)
+#else
+#define BENCH_APERTURE_SWITCH   (0U)
+#endif
+
+/* Port_EnterSafeState gates the ports left with disabled pins only and Port_RestoreState clocks them
+ * again, one read-modify-write of RCGC2 each and a read of PRGPIO on restore, when the clock gating is enabled.
+ * So does Port_SetPinMode, for a port whose only pin goes to analog mode and back */
+#if (PORT_CLOCK_GATING == STD_ON)
+#define BENCH_CLOCK_GATE(Accesses)    (Accesses)
+#else
+#define BENCH_CLOCK_GATE(Accesses)    (0U)
+#endif
+
+/* With PORT_ATOMIC_ACCESS every read-modify-write becomes a compare and swap that loads the register
+ * once more, in place of the shadow reads of the plain build */
+#if (PORT_ATOMIC_ACCESS == STD_ON)
+#define BENCH_ATOMIC(Loads)    (Loads)
+#else
+#define BENCH_ATOMIC(Loads)    (0U)
+#endif
+
+/* Port_RefreshPortDirection reads at most PORT_REFRESH_PORTS_PER_CALL ports per call. The repair of a
+ * drifted port is a compare and swap from the shadow with PORT_ATOMIC_ACCESS, which fails once on the
+ * drifted register and loads it again */
+#define BENCH_REFRESH_PORTS(Ports)    (((Ports) < PORT_REFRESH_PORTS_PER_CALL) ? (Ports) : PORT_REFRESH_PORTS_PER_CALL)
+
+/* Single pin updates cost a read-modify-write per register, or one store per bit through the bit-band alias */
+#if (PORT_BITBAND_ACCESS == STD_ON)
+#define BENCH_PIN_ACCESS(Rmw, BitBand)    (BitBand)
+#else
+#define BENCH_PIN_ACCESS(Rmw, BitBand)    (Rmw)
+#endif
+
+/* Port_Init seeds the pad registers of every port with configured pins and programs their GPIODR2R,
+ * GPIOODR and GPIOSLR, and the GPIODR4R and GPIODR8R of the ports with stronger drives, so that a pad
+ * setting changed at runtime is undone. Port_VerifyConfiguration reads back the pad registers it programs */
+static const Bench_BudgetType Bench_Budgets[] =
+{
+	/* Configuration          API                             Loads  Stores */
+	{ "Port_Configuration",   "Port_Init",                    76 + BENCH_APERTURE_SWITCH + BENCH_ATOMIC(1), 60 + BENCH_APERTURE_SWITCH },
+	{ "Port_Configuration",   "Port_SetPinDirection",         BENCH_ATOMIC(1), 1 },
+	{ "Port_Configuration",   "Port_SetPinMode",              BENCH_PIN_ACCESS(BENCH_ATOMIC(2), 0), BENCH_PIN_ACCESS(2, 3) },
+	{ "Port_Configuration",   "Port_RefreshPortDirection",    0,     0 },
+	{ "Port_Configuration",   "Port_WritePin",                0,     1 },
+	{ "Port_Configuration",   "Port_SetPinPad",               0,     1 },
+	{ "Port_Configuration",   "Port_SetPinGroup",             0,     30 },
+	{ "Port_Configuration",   "Port_CommitUpdate",            0,     36 },
+	{ "Port_Configuration",   "Port_GetPinState",             0,     0 },
+	{ "Port_Configuration",   "Port_VerifyConfiguration",     54,    0 },
+	{ "Port_Configuration",   "Port_SwitchConfiguration",     0,     3 },
+	{ "Port_Configuration",   "Port_EnterSafeState",          6 + BENCH_CLOCK_GATE(1), 13 + BENCH_CLOCK_GATE(1) },
+	{ "Port_Configuration",   "Port_RestoreState",            0 + BENCH_CLOCK_GATE(2 + BENCH_ATOMIC(1)), 13 + BENCH_CLOCK_GATE(1) },
+
+	{ "Synthetic_08",         "Port_Init",                    75 + BENCH_APERTURE_SWITCH + BENCH_ATOMIC(1), 57 + BENCH_APERTURE_SWITCH },
+	{ "Synthetic_08",         "Port_SetPinDirection",         BENCH_ATOMIC(1), 1 },
+	{ "Synthetic_08",         "Port_SetPinMode",              BENCH_PIN_ACCESS(BENCH_ATOMIC(2), 0) + BENCH_CLOCK_GATE(2), BENCH_PIN_ACCESS(2, 3) + BENCH_CLOCK_GATE(1) },
+	{ "Synthetic_08",         "Port_RefreshPortDirection",    BENCH_REFRESH_PORTS(2) + BENCH_ATOMIC(2), 1 },
+	{ "Synthetic_08",         "Port_WritePin",                0,     1 },
+	{ "Synthetic_08",         "Port_SetPinPad",               0,     1 },
+	{ "Synthetic_08",         "Port_SetPinGroup",             0,     30 },
+	{ "Synthetic_08",         "Port_CommitUpdate",            0,     36 },
+	{ "Synthetic_08",         "Port_GetPinState",             0,     0 },
+	{ "Synthetic_08",         "Port_VerifyConfiguration",     51,    0 },
+	{ "Synthetic_08",         "Port_SwitchConfiguration",     0,     4 },
+	{ "Synthetic_08",         "Port_EnterSafeState",          6 + BENCH_CLOCK_GATE(1), 6 + BENCH_CLOCK_GATE(1) },
+	{ "Synthetic_08",         "Port_RestoreState",            0 + BENCH_CLOCK_GATE(2 + BENCH_ATOMIC(1)), 9 + BENCH_CLOCK_GATE(1) },
+
+	{ "Synthetic_16",         "Port_Init",                    75 + BENCH_APERTURE_SWITCH + BENCH_ATOMIC(1), 57 + BENCH_APERTURE_SWITCH },
+	{ "Synthetic_16",         "Port_SetPinDirection",         BENCH_ATOMIC(1), 1 },
+	{ "Synthetic_16",         "Port_SetPinMode",              BENCH_PIN_ACCESS(BENCH_ATOMIC(2), 0), BENCH_PIN_ACCESS(2, 3) },
+	{ "Synthetic_16",         "Port_RefreshPortDirection",    BENCH_REFRESH_PORTS(3) + BENCH_ATOMIC(2), 1 },
+	{ "Synthetic_16",         "Port_WritePin",                0,     1 },
+	{ "Synthetic_16",         "Port_SetPinPad",               0,     1 },
+	{ "Synthetic_16",         "Port_SetPinGroup",             0,     30 },
+	{ "Synthetic_16",         "Port_CommitUpdate",            0,     36 },
+	{ "Synthetic_16",         "Port_GetPinState",             0,     0 },
+	{ "Synthetic_16",         "Port_VerifyConfiguration",     51,    0 },
+	{ "Synthetic_16",         "Port_SwitchConfiguration",     0,     4 },
+	{ "Synthetic_16",         "Port_EnterSafeState",          6 + BENCH_CLOCK_GATE(1), 6 + BENCH_CLOCK_GATE(1) },
+	{ "Synthetic_16",         "Port_RestoreState",            0 + BENCH_CLOCK_GATE(2 + BENCH_ATOMIC(1)), 9 + BENCH_CLOCK_GATE(1) },
+
+	{ "Synthetic_24",         "Port_Init",                    75 + BENCH_APERTURE_SWITCH + BENCH_ATOMIC(1), 57 + BENCH_APERTURE_SWITCH },
+	{ "Synthetic_24",         "Port_SetPinDirection",         BENCH_ATOMIC(1), 1 },
+	{ "Synthetic_24",         "Port_SetPinMode",              BENCH_PIN_ACCESS(BENCH_ATOMIC(2), 0), BENCH_PIN_ACCESS(2, 3) },
+	{ "Synthetic_24",         "Port_RefreshPortDirection",    BENCH_REFRESH_PORTS(3) + BENCH_ATOMIC(2), 1 },
+	{ "Synthetic_24",         "Port_WritePin",                0,     1 },
+	{ "Synthetic_24",         "Port_SetPinPad",               0,     1 },
+	{ "Synthetic_24",         "Port_SetPinGroup",             0,     30 },
+	{ "Synthetic_24",         "Port_CommitUpdate",            0,     36 },
+	{ "Synthetic_24",         "Port_GetPinState",             0,     0 },
+	{ "Synthetic_24",         "Port_VerifyConfiguration",     51,    0 },
+	{ "Synthetic_24",         "Port_SwitchConfiguration",     0,     4 },
+	{ "Synthetic_24",         "Port_EnterSafeState",          6 + BENCH_CLOCK_GATE(1), 6 + BENCH_CLOCK_GATE(1) },
+	{ "Synthetic_24",         "Port_RestoreState",            0 + BENCH_CLOCK_GATE(2 + BENCH_ATOMIC(1)), 9 + BENCH_CLOCK_GATE(1) },
+
+	{ "Synthetic_32",         "Port_Init",                    75 + BENCH_APERTURE_SWITCH + BENCH_ATOMIC(1), 62 + BENCH_APERTURE_SWITCH },
+	{ "Synthetic_32",         "Port_SetPinDirection",         BENCH_ATOMIC(1), 1 },
+	{ "Synthetic_32",         "Port_SetPinMode",              BENCH_PIN_ACCESS(BENCH_ATOMIC(2), 0), BENCH_PIN_ACCESS(2, 3) },
+	{ "Synthetic_32",         "Port_RefreshPortDirection",    BENCH_REFRESH_PORTS(4) + BENCH_ATOMIC(2), 1 },
+	{ "Synthetic_32",         "Port_WritePin",                0,     1 },
+	{ "Synthetic_32",         "Port_SetPinPad",               0,     1 },
+	{ "Synthetic_32",         "Port_SetPinGroup",             0,     30 },
+	{ "Synthetic_32",         "Port_CommitUpdate",            0,     36 },
+	{ "Synthetic_32",         "Port_GetPinState",             0,     0 },
+	{ "Synthetic_32",         "Port_VerifyConfiguration",     54,    0 },
+	{ "Synthetic_32",         "Port_SwitchConfiguration",     0,     4 },
+	{ "Synthetic_32",         "Port_EnterSafeState",          6,     12 },
+	{ "Synthetic_32",         "Port_RestoreState",            0,     17 },
+
+	{ "Synthetic_39",         "Port_Init",                    76 + BENCH_APERTURE_SWITCH + BENCH_ATOMIC(1), 64 + BENCH_APERTURE_SWITCH },
+	{ "Synthetic_39",         "Port_SetPinDirection",         BENCH_ATOMIC(1), 1 },
+	{ "Synthetic_39",         "Port_SetPinMode",              BENCH_PIN_ACCESS(BENCH_ATOMIC(2), 0), BENCH_PIN_ACCESS(2, 3) },
+	{ "Synthetic_39",         "Port_RefreshPortDirection",    BENCH_REFRESH_PORTS(4) + BENCH_ATOMIC(2), 1 },
+	{ "Synthetic_39",         "Port_WritePin",                0,     1 },
+	{ "Synthetic_39",         "Port_SetPinPad",               0,     1 },
+	{ "Synthetic_39",         "Port_SetPinGroup",             0,     30 },
+	{ "Synthetic_39",         "Port_CommitUpdate",            0,     36 },
+	{ "Synthetic_39",         "Port_GetPinState",             0,     0 },
+	{ "Synthetic_39",         "Port_VerifyConfiguration",     54,    0 },
+	{ "Synthetic_39",         "Port_SwitchConfiguration",     0,     4 },
+	{ "Synthetic_39",         "Port_EnterSafeState",          6,     12 },
+	{ "Synthetic_39",         "Port_RestoreState",            0,     17 }
+};
+
+#endif /* PORT_BENCH_BUDGET_H */
@@ -0,0 +1,912 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_CfgGen.c
+ *
+ * Description: Host side configuration generator for TM4C123GH6PM Microcontroller - Port Driver.
+ *              Reads one pin description file per configuration set, validates them and
+ *              emits Port_PBcfg.c with the configured pins, their build time checks and the
+ *              precomputed register image of every port of every set, and Port_PBcfg.h with
+ *              the symbolic Port Pin IDs, written next to it.
+ *
+ *              Build: cc -I.. -I<AUTOSAR include path> Port_CfgGen.c -o Port_CfgGen
+ *              Define PORT_CFGGEN_NO_MAIN to link the parser and folding functions into another tool,
+ *              Port_CfgGen_Test.c does so to test the parser and the validation.
+ *              Usage: Port_CfgGen Port_Pins.cfg [Port_Pins_<Set>.cfg ...] ../Port_PBcfg.c
+ *
+ * Author: Mazen Hekal
+ ******************************************************************************/
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Port_CfgGen.h"
+
+/* Maximum length of one line of the pin description file */
+#define CFGGEN_LINE_LENGTH      (256U)
+
+/* Number of pins in one GPIO port */
+#define CFGGEN_PINS_PER_PORT    PORT_PINS_PER_PORT
+
+/* Modes supported by every pin, 0 for pins that do not exist */
+static const uint16 CfgGen_PinCapabilities[PORT_NUMBER_OF_PORTS][CFGGEN_PINS_PER_PORT] =
+{
+	PORT_PIN_MODES_TABLE(PORT_PIN_MODES_INITIALIZER, 0, 0)
+};
+
+/* Names of the registers of a port register image, indexed by their position in the image */
+static const char * const CfgGen_RegNames[PORT_IMAGE_REGS] =
+{
+	"GPIODATA", "GPIOPCTL", "GPIOAFSEL", "GPIOAMSEL", "GPIODEN", "GPIOPUR", "GPIOPDR", "GPIODIR",
+	"GPIODR2R", "GPIODR4R", "GPIODR8R", "GPIOODR", "GPIOSLR"
+};
+
+/* Symbolic names used for the fields of a pin in the generated file */
+static const char * const CfgGen_DirectionNames[] = { "PORT_PIN_IN", "PORT_PIN_OUT" };
+static const char * const CfgGen_ResistorNames[] = { "PORT_PIN_OFF", "PORT_PIN_PULL_UP", "PORT_PIN_PULL_DOWN" };
+static const char * const CfgGen_DriveNames[] = { "PORT_PIN_DRIVE_2MA", "PORT_PIN_DRIVE_4MA", "PORT_PIN_DRIVE_8MA" };
+
+/************************************************************************************
+ * Function Name: CfgGen_Lookup
+ * Description: Returns the index of Token inside Names or -1 if it is not found
+ ************************************************************************************/
+static int CfgGen_Lookup(const char * Token, const char * const * Names, int Count)
+{
+	for(int i = 0; i < Count; i++)
+	{
+		if(strcmp(Token, Names[i]) == 0)
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_ParseMode
+ * Description: Parses DIO, ANALOG or ALTxx into a Port_PinModeType, returns -1 on error
+ ************************************************************************************/
+static int CfgGen_ParseMode(const char * Token)
+{
+	if(strcmp(Token, "DIO") == 0)
+	{
+		return PORT_MODE_DIO;
+	}
+	if(strcmp(Token, "ANALOG") == 0)
+	{
+		return PORT_MODE_ANALOG;
+	}
+	if((strncmp(Token, "ALT", 3) == 0) && (strlen(Token) == 5))
+	{
+		int mode = atoi(Token + 3);
+		if((mode >= (int)PORT_MODE_ALT01) && (mode <= (int)PORT_MODE_ALT14))
+		{
+			return mode;
+		}
+	}
+	return -1;
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_ParsePinName
+ * Description: Parses a Pxn pin name into the port and pin numbers of a pin,
+ *              returns 0 on success or -1 with a message written to stderr
+ ************************************************************************************/
+static int CfgGen_ParsePinName(const char * Name, uint16 LineNumber, Port_ConfigPin * Pin)
+{
+	if((strlen(Name) != 3) || (Name[0] != 'P') || (Name[1] < 'A') || (Name[1] >= (char)('A' + PORT_NUMBER_OF_PORTS))
+			|| (Name[2] < '0') || (Name[2] >= (char)('0' + CFGGEN_PINS_PER_PORT)))
+	{
+		fprintf(stderr, "line %u: invalid pin name '%s'\n", LineNumber, Name);
+		return -1;
+	}
+	Pin->port_Num = (Port_PortType)(Name[1] - 'A');
+	Pin->pin_Num = (Port_PinType)(Name[2] - '0');
+	return 0;
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_ParsePin
+ * Description: Parses one pin description line:
+ *              <Pxn> <IN|OUT> <OFF|PULL_UP|PULL_DOWN> <LOW|HIGH> <DIO|ANALOG|ALTxx> <dir changeable> <mode changeable>
+ *              [DRIVE_2MA|DRIVE_4MA|DRIVE_8MA] [SLEW] [OPEN_DRAIN]
+ *              Returns 0 on success or -1 with a message written to stderr
+ ************************************************************************************/
+int CfgGen_ParsePin(const char * Line, uint16 LineNumber, Port_ConfigPin * Pin)
+{
+	static const char * const Directions[] = { "IN", "OUT" };
+	static const char * const Resistors[] = { "OFF", "PULL_UP", "PULL_DOWN" };
+	static const char * const Levels[] = { "LOW", "HIGH" };
+	static const char * const Booleans[] = { "FALSE", "TRUE" };
+	static const char * const Drives[] = { "DRIVE_2MA", "DRIVE_4MA", "DRIVE_8MA" };
+	char name[16], direction[16], resistor[16], level[16], mode[16], dir_Changeable[16], mode_Changeable[16], pad[16];
+	int direction_Idx, resistor_Idx, level_Idx, mode_Val, dir_Changeable_Idx, mode_Changeable_Idx;
+	int consumed = 0;
+
+	if(sscanf(Line, "%15s %15s %15s %15s %15s %15s %15s%n", name, direction, resistor, level, mode,
+			dir_Changeable, mode_Changeable, &consumed) != 7)
+	{
+		fprintf(stderr, "line %u: expected 7 fields\n", LineNumber);
+		return -1;
+	}
+	if(CfgGen_ParsePinName(name, LineNumber, Pin) != 0)
+	{
+		return -1;
+	}
+	direction_Idx = CfgGen_Lookup(direction, Directions, 2);
+	resistor_Idx = CfgGen_Lookup(resistor, Resistors, 3);
+	level_Idx = CfgGen_Lookup(level, Levels, 2);
+	mode_Val = CfgGen_ParseMode(mode);
+	dir_Changeable_Idx = CfgGen_Lookup(dir_Changeable, Booleans, 2);
+	mode_Changeable_Idx = CfgGen_Lookup(mode_Changeable, Booleans, 2);
+	if((direction_Idx < 0) || (resistor_Idx < 0) || (level_Idx < 0) || (mode_Val < 0)
+			|| (dir_Changeable_Idx < 0) || (mode_Changeable_Idx < 0))
+	{
+		fprintf(stderr, "line %u: invalid field value for %s\n", LineNumber, name);
+		return -1;
+	}
+
+	Pin->pin_Direction = (Port_PinDirection)direction_Idx;
+	Pin->internal_Resistor = (Port_InternalResistor)resistor_Idx;
+	Pin->pin_Init_Value = (level_Idx != 0) ? STD_HIGH : STD_LOW;
+	Pin->pin_Mode = (Port_PinModeType)mode_Val;
+	Pin->pin_Direction_Changeable = (dir_Changeable_Idx != 0) ? TRUE : FALSE;
+	Pin->pin_Mode_Changeable = (mode_Changeable_Idx != 0) ? TRUE : FALSE;
+
+	/* Optional pad settings, the reset state is a 2-mA push-pull output without slew rate control */
+	Pin->drive_Strength = PORT_PIN_DRIVE_2MA;
+	Pin->slew_Rate_Control = FALSE;
+	Pin->open_Drain = FALSE;
+	Line += consumed;
+	while(sscanf(Line, "%15s%n", pad, &consumed) == 1)
+	{
+		int drive_Idx = CfgGen_Lookup(pad, Drives, 3);
+		Line += consumed;
+		if(drive_Idx >= 0)
+		{
+			Pin->drive_Strength = (Port_PinDriveType)drive_Idx;
+		}
+		else if(strcmp(pad, "SLEW") == 0)
+		{
+			Pin->slew_Rate_Control = TRUE;
+		}
+		else if(strcmp(pad, "OPEN_DRAIN") == 0)
+		{
+			Pin->open_Drain = TRUE;
+		}
+		else
+		{
+			fprintf(stderr, "line %u: invalid pad setting '%s' for %s\n", LineNumber, pad, name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_ParseAhb
+ * Description: Parses a line selecting the ports accessed through the AHB aperture:
+ *              AHB <PORTx> [<PORTx> ...]
+ *              Returns 0 on success or -1 with a message written to stderr
+ ************************************************************************************/
+int CfgGen_ParseAhb(const char * Line, uint16 LineNumber, uint8 * AhbMask)
+{
+	char port[16];
+	int consumed = 0;
+	uint8 ports = 0;
+
+	Line += strspn(Line, " \t");
+	Line += strlen("AHB");
+	while(sscanf(Line, "%15s%n", port, &consumed) == 1)
+	{
+		Line += consumed;
+		if((strlen(port) != 5) || (strncmp(port, "PORT", 4) != 0) || (port[4] < 'A')
+				|| (port[4] >= (char)('A' + PORT_NUMBER_OF_PORTS)))
+		{
+			fprintf(stderr, "line %u: invalid port name '%s'\n", LineNumber, port);
+			return -1;
+		}
+		*AhbMask |= (uint8)(1U << (port[4] - 'A'));
+		ports++;
+	}
+	if(ports == 0)
+	{
+		fprintf(stderr, "line %u: AHB expects at least one port\n", LineNumber);
+		return -1;
+	}
+	return 0;
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_ParseName
+ * Description: Parses a line naming the configuration set:
+ *              NAME <C identifier>
+ *              Returns 0 on success or -1 with a message written to stderr
+ ************************************************************************************/
+int CfgGen_ParseName(const char * Line, uint16 LineNumber, char * Name)
+{
+	char name[CFGGEN_NAME_LENGTH];
+	char extra[2];
+
+	Line += strspn(Line, " \t");
+	Line += strlen("NAME");
+	if((sscanf(Line, "%63s %1s", name, extra) != 1) || (strspn(name, "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz_0123456789") != strlen(name))
+			|| ((name[0] >= '0') && (name[0] <= '9')))
+	{
+		fprintf(stderr, "line %u: NAME expects one C identifier\n", LineNumber);
+		return -1;
+	}
+	strcpy(Name, name);
+	return 0;
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_ParseSafe
+ * Description: Parses a line giving the safe state of a configured pin:
+ *              SAFE <Pxn> <IN|OUT> <OFF|PULL_UP|PULL_DOWN> <LOW|HIGH>
+ *              Returns 0 on success or -1 with a message written to stderr
+ ************************************************************************************/
+int CfgGen_ParseSafe(const char * Line, uint16 LineNumber, Port_ConfigPin * Safe)
+{
+	static const char * const Directions[] = { "IN", "OUT" };
+	static const char * const Resistors[] = { "OFF", "PULL_UP", "PULL_DOWN" };
+	static const char * const Levels[] = { "LOW", "HIGH" };
+	char name[16], direction[16], resistor[16], level[16];
+	int direction_Idx, resistor_Idx, level_Idx;
+
+	Line += strspn(Line, " \t");
+	Line += strlen("SAFE");
+	if(sscanf(Line, "%15s %15s %15s %15s", name, direction, resistor, level) != 4)
+	{
+		fprintf(stderr, "line %u: SAFE expects a pin, a direction, a resistor and a level\n", LineNumber);
+		return -1;
+	}
+	if(CfgGen_ParsePinName(name, LineNumber, Safe) != 0)
+	{
+		return -1;
+	}
+	direction_Idx = CfgGen_Lookup(direction, Directions, 2);
+	resistor_Idx = CfgGen_Lookup(resistor, Resistors, 3);
+	level_Idx = CfgGen_Lookup(level, Levels, 2);
+	if((direction_Idx < 0) || (resistor_Idx < 0) || (level_Idx < 0))
+	{
+		fprintf(stderr, "line %u: invalid safe state for %s\n", LineNumber, name);
+		return -1;
+	}
+	Safe->pin_Direction = (Port_PinDirection)direction_Idx;
+	Safe->internal_Resistor = (Port_InternalResistor)resistor_Idx;
+	Safe->pin_Init_Value = (level_Idx != 0) ? STD_HIGH : STD_LOW;
+	Safe->pin_Mode = PORT_MODE_DIO;
+	Safe->pin_Direction_Changeable = FALSE;
+	Safe->pin_Mode_Changeable = FALSE;
+	Safe->drive_Strength = PORT_PIN_DRIVE_2MA;
+	Safe->slew_Rate_Control = FALSE;
+	Safe->open_Drain = FALSE;
+	return 0;
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_ValidatePin
+ * Description: Rejects JTAG pins, pins that do not exist, modes the pin does not support,
+ *              slew rate control without the 8-mA drive, and pad settings of a pin in analog mode
+ ************************************************************************************/
+int CfgGen_ValidatePin(const Port_ConfigPin * Pin, uint16 LineNumber)
+{
+	uint16 capabilities = CfgGen_PinCapabilities[Pin->port_Num][Pin->pin_Num];
+
+	if((Pin->port_Num == PORTC) && (Pin->pin_Num <= 3))
+	{
+		fprintf(stderr, "line %u: PC%u is a JTAG pin and can not be configured\n", LineNumber, Pin->pin_Num);
+		return -1;
+	}
+	if(capabilities == 0)
+	{
+		fprintf(stderr, "line %u: P%c%u does not exist on this device\n", LineNumber, 'A' + Pin->port_Num, Pin->pin_Num);
+		return -1;
+	}
+	if((capabilities & PORT_MODE_BIT(Pin->pin_Mode)) == 0)
+	{
+		fprintf(stderr, "line %u: mode %u is not supported by P%c%u\n", LineNumber, Pin->pin_Mode,
+				'A' + Pin->port_Num, Pin->pin_Num);
+		return -1;
+	}
+	if((Pin->slew_Rate_Control == TRUE) && (Pin->drive_Strength != PORT_PIN_DRIVE_8MA))
+	{
+		fprintf(stderr, "line %u: SLEW needs DRIVE_8MA on P%c%u\n", LineNumber, 'A' + Pin->port_Num, Pin->pin_Num);
+		return -1;
+	}
+	if((Pin->pin_Mode == PORT_MODE_ANALOG)
+			&& ((Pin->drive_Strength != PORT_PIN_DRIVE_2MA) || (Pin->slew_Rate_Control == TRUE) || (Pin->open_Drain == TRUE)))
+	{
+		fprintf(stderr, "line %u: P%c%u in ANALOG mode takes no pad setting\n", LineNumber, 'A' + Pin->port_Num, Pin->pin_Num);
+		return -1;
+	}
+	return 0;
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_ImageWrite
+ * Description: Records the value of the masked bits of one register inside a port register image
+ ************************************************************************************/
+static void CfgGen_ImageWrite(Port_RegImageType * Reg, uint32 Mask, uint32 Value)
+{
+	Reg->mask |= Mask;
+	Reg->value = (Reg->value & ~Mask) | (Value & Mask);
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_FoldPad
+ * Description: Folds the drive strength, open drain and slew rate control of one pin into
+ *              the register image of its port. Only the selected drive register is set,
+ *              the hardware clears the pin in the two others
+ ************************************************************************************/
+void CfgGen_FoldPad(Port_PortImageType * Image, const Port_ConfigPin * Pin)
+{
+	uint32 pin_Mask = (uint32)1 << Pin->pin_Num;
+
+	for(uint8 drive = PORT_PIN_DRIVE_2MA; drive <= PORT_PIN_DRIVE_8MA; drive++)
+	{
+		Image->Regs[PORT_IMAGE_DRIVE_2MA + drive].mask &= ~pin_Mask;
+		Image->Regs[PORT_IMAGE_DRIVE_2MA + drive].value &= ~pin_Mask;
+	}
+	CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_DRIVE_2MA + Pin->drive_Strength], pin_Mask, pin_Mask);
+	CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_OPEN_DRAIN], pin_Mask, (Pin->open_Drain == TRUE) ? pin_Mask : 0);
+	CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_SLEW_RATE], pin_Mask, (Pin->slew_Rate_Control == TRUE) ? pin_Mask : 0);
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_FoldPin
+ * Description: Folds the configuration of one pin into the register image of its port,
+ *              setting exactly the bits the per pin programming sequence of Port_Init touches.
+ *              The pad registers are folded for every pin, also one left at the reset 2-mA
+ *              drive without slew rate control or open drain, so Port_Init and
+ *              Port_SwitchConfiguration undo a pad setting changed at runtime
+ ************************************************************************************/
+void CfgGen_FoldPin(Port_PortImageType * Image, const Port_ConfigPin * Pin)
+{
+	uint32 pin_Mask = (uint32)1 << Pin->pin_Num;
+	uint32 ctl_Mask = (uint32)0x0000000F << (Pin->pin_Num * 4);
+
+	if(((Pin->port_Num == PORTD) && (Pin->pin_Num == 7)) || ((Pin->port_Num == PORTF) && (Pin->pin_Num == 0)))
+	{
+		Image->commit_Mask |= (uint8)pin_Mask;
+	}
+
+	if(Pin->pin_Mode == PORT_MODE_DIO)
+	{
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_ANALOG_MODE_SEL], pin_Mask, 0);
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_ALT_FUNC], pin_Mask, 0);
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_CTL], ctl_Mask, 0);
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_DIGITAL_ENABLE], pin_Mask, pin_Mask);
+	}
+	else if(Pin->pin_Mode == PORT_MODE_ANALOG)
+	{
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_ANALOG_MODE_SEL], pin_Mask, pin_Mask);
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_DIGITAL_ENABLE], pin_Mask, 0);
+	}
+	else
+	{
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_ANALOG_MODE_SEL], pin_Mask, 0);
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_ALT_FUNC], pin_Mask, pin_Mask);
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_CTL], ctl_Mask, (uint32)Pin->pin_Mode << (Pin->pin_Num * 4));
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_DIGITAL_ENABLE], pin_Mask, pin_Mask);
+	}
+
+	if(Pin->pin_Direction == PORT_PIN_OUT)
+	{
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_DIR], pin_Mask, pin_Mask);
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_DATA], pin_Mask, (Pin->pin_Init_Value == STD_HIGH) ? pin_Mask : 0);
+	}
+	else
+	{
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_DIR], pin_Mask, 0);
+		if(Pin->internal_Resistor == PORT_PIN_PULL_UP)
+		{
+			CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_PULL_UP], pin_Mask, pin_Mask);
+		}
+		else if(Pin->internal_Resistor == PORT_PIN_PULL_DOWN)
+		{
+			CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_PULL_DOWN], pin_Mask, pin_Mask);
+		}
+		else
+		{
+			CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_PULL_UP], pin_Mask, 0);
+			CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_PULL_DOWN], pin_Mask, 0);
+		}
+	}
+
+	CfgGen_FoldPad(Image, Pin);
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_FoldSafe
+ * Description: Folds the safe state of one pin into the safe state image of its port.
+ *              The pin is taken back to a GPIO with its analog function off. An input has
+ *              its digital buffer disabled so a floating level does not draw current, an
+ *              output keeps its buffer and is driven to its safe level
+ ************************************************************************************/
+void CfgGen_FoldSafe(Port_PortImageType * Image, const Port_ConfigPin * Safe)
+{
+	uint32 pin_Mask = (uint32)1 << Safe->pin_Num;
+	uint32 ctl_Mask = (uint32)0x0000000F << (Safe->pin_Num * 4);
+
+	CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_ANALOG_MODE_SEL], pin_Mask, 0);
+	CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_ALT_FUNC], pin_Mask, 0);
+	CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_CTL], ctl_Mask, 0);
+	CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_PULL_UP], pin_Mask, (Safe->internal_Resistor == PORT_PIN_PULL_UP) ? pin_Mask : 0);
+	CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_PULL_DOWN], pin_Mask, (Safe->internal_Resistor == PORT_PIN_PULL_DOWN) ? pin_Mask : 0);
+
+	if(Safe->pin_Direction == PORT_PIN_OUT)
+	{
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_DATA], pin_Mask, (Safe->pin_Init_Value == STD_HIGH) ? pin_Mask : 0);
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_DIGITAL_ENABLE], pin_Mask, pin_Mask);
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_DIR], pin_Mask, pin_Mask);
+	}
+	else
+	{
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_DIGITAL_ENABLE], pin_Mask, 0);
+		CfgGen_ImageWrite(&Image->Regs[PORT_IMAGE_DIR], pin_Mask, 0);
+	}
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_FindDuplicate
+ * Description: Rejects a pin that is already part of the configuration
+ ************************************************************************************/
+int CfgGen_FindDuplicate(const CfgGen_ConfigType * Config, const Port_ConfigPin * Pin, uint16 LineNumber)
+{
+	for(uint8 i = 0; i < Config->NumberOfPins; i++)
+	{
+		if((Config->Pins[i].port_Num == Pin->port_Num) && (Config->Pins[i].pin_Num == Pin->pin_Num))
+		{
+			fprintf(stderr, "line %u: P%c%u is already configured at line %u\n", LineNumber,
+					'A' + Pin->port_Num, Pin->pin_Num, Config->Lines[i]);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_Read
+ * Description: Reads, validates and folds a whole pin description file
+ ************************************************************************************/
+int CfgGen_Read(FILE * Input, CfgGen_ConfigType * Config)
+{
+	char line[CFGGEN_LINE_LENGTH];
+	uint16 line_Number = 0;
+	int errors = 0;
+
+	memset(Config, 0, sizeof(*Config));
+	while(fgets(line, sizeof(line), Input) != NULL)
+	{
+		Port_ConfigPin pin;
+		char * comment = strchr(line, '#');
+		line_Number++;
+		if(comment != NULL)
+		{
+			*comment = '\0';
+		}
+		if(strspn(line, " \t\r\n") == strlen(line))
+		{
+			continue;
+		}
+		if(strncmp(line + strspn(line, " \t"), "AHB", 3) == 0)
+		{
+			if(CfgGen_ParseAhb(line, line_Number, &Config->ahb_Mask) != 0)
+			{
+				errors++;
+			}
+			continue;
+		}
+		if(strncmp(line + strspn(line, " \t"), "NAME", 4) == 0)
+		{
+			if(CfgGen_ParseName(line, line_Number, Config->Name) != 0)
+			{
+				errors++;
+			}
+			continue;
+		}
+		if(strncmp(line + strspn(line, " \t"), "SAFE", 4) == 0)
+		{
+			if(CfgGen_ParseSafe(line, line_Number, &pin) != 0)
+			{
+				errors++;
+				continue;
+			}
+			for(uint8 i = 0; i < Config->NumberOfSafePins; i++)
+			{
+				if((Config->SafePins[i].port_Num == pin.port_Num) && (Config->SafePins[i].pin_Num == pin.pin_Num))
+				{
+					fprintf(stderr, "line %u: the safe state of P%c%u is already given at line %u\n", line_Number,
+							'A' + pin.port_Num, pin.pin_Num, Config->SafeLines[i]);
+					errors++;
+				}
+			}
+			if(Config->NumberOfSafePins >= PORT_CONFIGURED_PINS)
+			{
+				fprintf(stderr, "line %u: more SAFE lines than PORT_CONFIGURED_PINS (%u)\n", line_Number, PORT_CONFIGURED_PINS);
+				return -1;
+			}
+			Config->SafeLines[Config->NumberOfSafePins] = line_Number;
+			Config->SafePins[Config->NumberOfSafePins++] = pin;
+			continue;
+		}
+		if((CfgGen_ParsePin(line, line_Number, &pin) != 0) || (CfgGen_ValidatePin(&pin, line_Number) != 0))
+		{
+			errors++;
+			continue;
+		}
+		if(CfgGen_FindDuplicate(Config, &pin, line_Number) != 0)
+		{
+			errors++;
+			continue;
+		}
+		if(Config->NumberOfPins >= PORT_CONFIGURED_PINS)
+		{
+			fprintf(stderr, "line %u: more than PORT_CONFIGURED_PINS (%u) pins\n", line_Number, PORT_CONFIGURED_PINS);
+			return -1;
+		}
+		Config->Lines[Config->NumberOfPins] = line_Number;
+		Config->Pins[Config->NumberOfPins++] = pin;
+		Config->clock_Mask |= (uint8)(1U << pin.port_Num);
+		CfgGen_FoldPin(&Config->Ports[pin.port_Num], &pin);
+	}
+	if((errors == 0) && (Config->NumberOfPins != PORT_CONFIGURED_PINS))
+	{
+		fprintf(stderr, "%u pins configured, PORT_CONFIGURED_PINS is %u\n", Config->NumberOfPins, PORT_CONFIGURED_PINS);
+		errors++;
+	}
+
+	/* Every configured pin is a disabled input in the safe state, unless a SAFE line says otherwise */
+	for(uint8 i = 0; i < Config->NumberOfPins; i++)
+	{
+		Port_ConfigPin safe = Config->Pins[i];
+		safe.pin_Direction = PORT_PIN_IN;
+		safe.internal_Resistor = PORT_PIN_OFF;
+		CfgGen_FoldSafe(&Config->Safe[safe.port_Num], &safe);
+	}
+	for(uint8 i = 0; i < Config->NumberOfSafePins; i++)
+	{
+		const Port_ConfigPin * safe = &Config->SafePins[i];
+		/* Every configured pin has its GPIODIR bit in the register image of its port */
+		if((Config->Ports[safe->port_Num].Regs[PORT_IMAGE_DIR].mask & (1U << safe->pin_Num)) == 0)
+		{
+			fprintf(stderr, "line %u: P%c%u has a safe state but is not configured\n", Config->SafeLines[i],
+					'A' + safe->port_Num, safe->pin_Num);
+			errors++;
+		}
+		else
+		{
+			CfgGen_FoldSafe(&Config->Safe[safe->port_Num], safe);
+		}
+	}
+#if (PORT_AHB_APERTURE == STD_OFF)
+	if(Config->ahb_Mask != 0)
+	{
+		fprintf(stderr, "warning: the AHB ports are ignored by the driver while PORT_AHB_APERTURE is STD_OFF\n");
+	}
+#endif
+	return (errors == 0) ? 0 : -1;
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_EmitImages
+ * Description: Writes the register images of the ports of one configuration set
+ ************************************************************************************/
+static void CfgGen_EmitImages(FILE * Output, const Port_PortImageType * Images)
+{
+	fprintf(Output, "\t\t{\n");
+	for(uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+	{
+		const Port_PortImageType * image = &Images[port];
+		fprintf(Output, "\t\t\t\t{\t/* PORT%c */\n\t\t\t\t\t\t{\n", 'A' + port);
+		for(uint8 reg = 0; reg < PORT_IMAGE_REGS; reg++)
+		{
+			fprintf(Output, "\t\t\t\t\t\t\t\t{0x%08lX, 0x%08lX}%s\t/* %s */\n",
+					(unsigned long)image->Regs[reg].mask, (unsigned long)image->Regs[reg].value,
+					(reg + 1U < PORT_IMAGE_REGS) ? "," : " ", CfgGen_RegNames[reg]);
+		}
+		fprintf(Output, "\t\t\t\t\t\t},\n\t\t\t\t\t\t0x%02X\t\t\t\t\t\t\t\t\t/* GPIOCR unlock mask */\n\t\t\t\t}%s\n",
+				image->commit_Mask, (port + 1U < PORT_NUMBER_OF_PORTS) ? "," : "");
+	}
+	fprintf(Output, "\t\t},\n");
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_EmitSet
+ * Description: Writes the pins and the register images of one configuration set
+ ************************************************************************************/
+static void CfgGen_EmitSet(FILE * Output, const CfgGen_ConfigType * Config)
+{
+	char pins[CFGGEN_NAME_LENGTH + 8];
+
+	/* The pins are listed once as PIN(...) rows, expanded into the initializer and the build time checks */
+	for(uint8 i = 0; Config->Name[i] != '\0'; i++)
+	{
+		pins[i] = (char)toupper((unsigned char)Config->Name[i]);
+		pins[i + 1] = '\0';
+	}
+	strcat(pins, "_PINS");
+	fprintf(Output, "/* Pins of %s, one PIN(...) row per Port Pin ID in the field order of Port_ConfigPin */\n"
+			"#define %s(PIN) \\\n", Config->Name, pins);
+	for(uint8 i = 0; i < Config->NumberOfPins; i++)
+	{
+		const Port_ConfigPin * pin = &Config->Pins[i];
+		char mode[24];
+		if(pin->pin_Mode == PORT_MODE_DIO)
+		{
+			snprintf(mode, sizeof(mode), "PORT_MODE_DIO");
+		}
+		else if(pin->pin_Mode == PORT_MODE_ANALOG)
+		{
+			snprintf(mode, sizeof(mode), "PORT_MODE_ANALOG");
+		}
+		else
+		{
+			snprintf(mode, sizeof(mode), "PORT_MODE_ALT%02u", pin->pin_Mode);
+		}
+		fprintf(Output, "\t\tPIN(PORT%c,PIN%u,%s,%s,%s,%s,%s,%s,%s,%s,%s)\t/*P%c%u*/%s\n",
+				'A' + pin->port_Num, pin->pin_Num, CfgGen_DirectionNames[pin->pin_Direction],
+				CfgGen_ResistorNames[pin->internal_Resistor], (pin->pin_Init_Value == STD_HIGH) ? "STD_HIGH" : "STD_LOW",
+				mode, pin->pin_Direction_Changeable ? "TRUE" : "FALSE", pin->pin_Mode_Changeable ? "TRUE" : "FALSE",
+				CfgGen_DriveNames[pin->drive_Strength], pin->slew_Rate_Control ? "TRUE" : "FALSE",
+				pin->open_Drain ? "TRUE" : "FALSE",
+				'A' + pin->port_Num, pin->pin_Num, (i + 1U < Config->NumberOfPins) ? " \\" : "");
+	}
+	fprintf(Output, "\nPORT_CHECK_PINS(%s, %s);\n\n", Config->Name, pins);
+	fprintf(Output, "const Port_ConfigType %s = {\n\t\t{\n\t\t\t\t%s(PORT_PIN_INITIALIZER)\n\t\t},\n", Config->Name, pins);
+	CfgGen_EmitImages(Output, Config->Ports);
+	fprintf(Output, "\t\t/* Safe state */\n");
+	CfgGen_EmitImages(Output, Config->Safe);
+	fprintf(Output, "\t\t0x%02X,\t/* Clock gating mask of the used ports */\n", Config->clock_Mask);
+	fprintf(Output, "\t\t0x%02X\t/* Ports accessed through the AHB aperture */\n};\n", Config->ahb_Mask);
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_Emit
+ * Description: Writes the Port_PBcfg.c source file of validated configuration sets,
+ *              the first one is Port_Configuration
+ ************************************************************************************/
+void CfgGen_Emit(FILE * Output, const CfgGen_ConfigType * Configs, uint8 NumberOfConfigs)
+{
+	fprintf(Output,
+			"/******************************************************************************\n"
+			" *\n"
+			" * Module: Port\n"
+			" *\n"
+			" * File Name: Port_PBcfg.c\n"
+			" *\n"
+			" * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Port Driver\n"
+			" *              Generated by Tools/Port_CfgGen from the pin description, do not edit.\n"
+			" *\n"
+			" * Author: Mazen Hekal\n"
+			" ******************************************************************************/\n"
+			"\n"
+			"#include \"Port.h\"\n"
+			"\n"
+			"/*\n"
+			" * Module Version %u.%u.%u\n"
+			" */\n"
+			"#define PORT_PBCFG_SW_MAJOR_VERSION              (%uU)\n"
+			"#define PORT_PBCFG_SW_MINOR_VERSION              (%uU)\n"
+			"#define PORT_PBCFG_SW_PATCH_VERSION              (%uU)\n"
+			"\n"
+			"/*\n"
+			" * AUTOSAR Version %u.%u.%u\n"
+			" */\n"
+			"#define PORT_PBCFG_AR_RELEASE_MAJOR_VERSION     (%uU)\n"
+			"#define PORT_PBCFG_AR_RELEASE_MINOR_VERSION     (%uU)\n"
+			"#define PORT_PBCFG_AR_RELEASE_PATCH_VERSION     (%uU)\n"
+			"\n"
+			"/* AUTOSAR Version checking between Port_PBcfg.c and Port.h files */\n"
+			"#if ((PORT_PBCFG_AR_RELEASE_MAJOR_VERSION != PORT_AR_RELEASE_MAJOR_VERSION)\\\n"
+			"\t\t||  (PORT_PBCFG_AR_RELEASE_MINOR_VERSION != PORT_AR_RELEASE_MINOR_VERSION)\\\n"
+			"\t\t||  (PORT_PBCFG_AR_RELEASE_PATCH_VERSION != PORT_AR_RELEASE_PATCH_VERSION))\n"
+			"#error \"The AR version of PBcfg.c does not match the expected version\"\n"
+			"#endif\n"
+			"\n"
+			"/* Software Version checking between Port_PBcfg.c and Port.h files */\n"
+			"#if ((PORT_PBCFG_SW_MAJOR_VERSION != PORT_SW_MAJOR_VERSION)\\\n"
+			"\t\t||  (PORT_PBCFG_SW_MINOR_VERSION != PORT_SW_MINOR_VERSION)\\\n"
+			"\t\t||  (PORT_PBCFG_SW_PATCH_VERSION != PORT_SW_PATCH_VERSION))\n"
+			"#error \"The SW version of PBcfg.c does not match the expected version\"\n"
+			"#endif\n"
+			"\n"
+			"\n"
+			"\n",
+			PORT_SW_MAJOR_VERSION, PORT_SW_MINOR_VERSION, PORT_SW_PATCH_VERSION,
+			PORT_SW_MAJOR_VERSION, PORT_SW_MINOR_VERSION, PORT_SW_PATCH_VERSION,
+			PORT_AR_RELEASE_MAJOR_VERSION, PORT_AR_RELEASE_MINOR_VERSION, PORT_AR_RELEASE_PATCH_VERSION,
+			PORT_AR_RELEASE_MAJOR_VERSION, PORT_AR_RELEASE_MINOR_VERSION, PORT_AR_RELEASE_PATCH_VERSION);
+
+	for(uint8 set = 0; set < NumberOfConfigs; set++)
+	{
+		if(set > 0)
+		{
+			fprintf(Output, "\n/* Configuration set %u */\n", set);
+		}
+		CfgGen_EmitSet(Output, &Configs[set]);
+	}
+
+	fprintf(Output, "\n/* Configuration sets selectable with Port_Init and Port_SwitchConfiguration */\n"
+			"#if (PORT_CONFIGURATION_SETS != %uU)\n"
+			"#error \"PORT_CONFIGURATION_SETS of Port_Cfg.h does not match the generated configuration sets\"\n"
+			"#endif\n"
+			"const Port_ConfigType * const Port_ConfigurationSets[PORT_CONFIGURATION_SETS] = {\n", NumberOfConfigs);
+	for(uint8 set = 0; set < NumberOfConfigs; set++)
+	{
+		fprintf(Output, "\t\t&%s%s\n", Configs[set].Name, (set + 1U < NumberOfConfigs) ? "," : "");
+	}
+	fprintf(Output, "};\n");
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_MatchPinIds
+ * Description: Rejects configuration sets that give a Port Pin ID to another pin than the
+ *              first set, the symbolic pin names of Port_PBcfg.h hold for every set
+ ************************************************************************************/
+int CfgGen_MatchPinIds(const CfgGen_ConfigType * Configs, uint8 NumberOfConfigs)
+{
+	int errors = 0;
+
+	for(uint8 set = 1; set < NumberOfConfigs; set++)
+	{
+		for(uint8 i = 0; i < Configs[set].NumberOfPins; i++)
+		{
+			const Port_ConfigPin * first = &Configs[0].Pins[i];
+			const Port_ConfigPin * pin = &Configs[set].Pins[i];
+			if((pin->port_Num != first->port_Num) || (pin->pin_Num != first->pin_Num))
+			{
+				fprintf(stderr, "line %u: Port Pin ID %u is P%c%u in %s but P%c%u in %s\n", Configs[set].Lines[i], i,
+						'A' + first->port_Num, first->pin_Num, Configs[0].Name, 'A' + pin->port_Num, pin->pin_Num,
+						Configs[set].Name);
+				errors++;
+			}
+		}
+	}
+	return (errors == 0) ? 0 : -1;
+}
+
+/************************************************************************************
+ * Function Name: CfgGen_EmitSymbols
+ * Description: Writes the Port_PBcfg.h header of the symbolic pin names, with the pins
+ *              whose direction and mode are changeable in every configuration set
+ ************************************************************************************/
+void CfgGen_EmitSymbols(FILE * Output, const CfgGen_ConfigType * Configs, uint8 NumberOfConfigs)
+{
+	fprintf(Output,
+			"/******************************************************************************\n"
+			" *\n"
+			" * Module: Port\n"
+			" *\n"
+			" * File Name: Port_PBcfg.h\n"
+			" *\n"
+			" * Description: Symbolic Port Pin IDs of the Post Build Configuration for TM4C123GH6PM Microcontroller - Port Driver\n"
+			" *              Generated by Tools/Port_CfgGen from the pin description, do not edit.\n"
+			" *\n"
+			" * Author: Mazen Hekal\n"
+			" ******************************************************************************/\n"
+			"\n"
+			"#ifndef PORT_PBCFG_H\n"
+			"#define PORT_PBCFG_H\n"
+			"\n"
+			"#include \"Port.h\"\n"
+			"\n"
+			"#if (PORT_CONFIGURED_PINS != %uU)\n"
+			"#error \"PORT_CONFIGURED_PINS of Port_Cfg.h does not match the generated Port Pin IDs\"\n"
+			"#endif\n"
+			"\n"
+			"/* Port Pin IDs, the same pin in every configuration set */\n", Configs[0].NumberOfPins);
+	for(uint8 i = 0; i < Configs[0].NumberOfPins; i++)
+	{
+		fprintf(Output, "#define PortConf_P%c%u\t\t\t\t((Port_PinType)%uU)\n",
+				'A' + Configs[0].Pins[i].port_Num, Configs[0].Pins[i].pin_Num, i);
+	}
+
+	fprintf(Output, "\n/* Pins whose direction and mode are changeable in every configuration set, checked at build time\n"
+			" * by PORT_SET_PIN_DIRECTION and PORT_SET_PIN_MODE */\n");
+	for(uint8 i = 0; i < Configs[0].NumberOfPins; i++)
+	{
+		boolean direction_Changeable = TRUE;
+		boolean mode_Changeable = TRUE;
+		for(uint8 set = 0; set < NumberOfConfigs; set++)
+		{
+			direction_Changeable = direction_Changeable && Configs[set].Pins[i].pin_Direction_Changeable;
+			mode_Changeable = mode_Changeable && Configs[set].Pins[i].pin_Mode_Changeable;
+		}
+		fprintf(Output, "#define PortConf_P%c%u_DIRECTION_CHANGEABLE\t(%s)\n"
+				"#define PortConf_P%c%u_MODE_CHANGEABLE\t\t(%s)\n",
+				'A' + Configs[0].Pins[i].port_Num, Configs[0].Pins[i].pin_Num, direction_Changeable ? "TRUE" : "FALSE",
+				'A' + Configs[0].Pins[i].port_Num, Configs[0].Pins[i].pin_Num, mode_Changeable ? "TRUE" : "FALSE");
+	}
+	fprintf(Output, "\n#endif /* PORT_PBCFG_H */\n");
+}
+
+#ifndef PORT_CFGGEN_NO_MAIN
+int main(int argc, char * argv[])
+{
+	static CfgGen_ConfigType configs[CFGGEN_MAX_SETS];
+	uint8 sets = (uint8)(argc - 2);
+	FILE * output;
+	char header[FILENAME_MAX];
+	char * dot;
+
+	if((argc < 3) || (sets > CFGGEN_MAX_SETS))
+	{
+		fprintf(stderr, "usage: %s <pin description> [<pin description> ...] <Port_PBcfg.c>, at most %u sets\n", argv[0],
+				CFGGEN_MAX_SETS);
+		return 2;
+	}
+	for(uint8 set = 0; set < sets; set++)
+	{
+		FILE * input = fopen(argv[1 + set], "r");
+		int result;
+		if(input == NULL)
+		{
+			perror(argv[1 + set]);
+			return 2;
+		}
+		result = CfgGen_Read(input, &configs[set]);
+		fclose(input);
+		if(result != 0)
+		{
+			fprintf(stderr, "%s: invalid pin description\n", argv[1 + set]);
+			return 1;
+		}
+		if(configs[set].Name[0] == '\0')
+		{
+			snprintf(configs[set].Name, CFGGEN_NAME_LENGTH, (set == 0) ? "Port_Configuration" : "Port_Configuration_%u", set);
+		}
+		if((set == 0) && (strcmp(configs[set].Name, "Port_Configuration") != 0))
+		{
+			fprintf(stderr, "%s: the first configuration set is Port_Configuration\n", argv[1 + set]);
+			return 1;
+		}
+		for(uint8 other = 0; other < set; other++)
+		{
+			if(strcmp(configs[set].Name, configs[other].Name) == 0)
+			{
+				fprintf(stderr, "%s: configuration set %s is already defined\n", argv[1 + set], configs[set].Name);
+				return 1;
+			}
+		}
+	}
+	if(CfgGen_MatchPinIds(configs, sets) != 0)
+	{
+		return 1;
+	}
+	output = fopen(argv[argc - 1], "w");
+	if(output == NULL)
+	{
+		perror(argv[argc - 1]);
+		return 2;
+	}
+	CfgGen_Emit(output, configs, sets);
+	fclose(output);
+
+	/* Port_PBcfg.h is written next to Port_PBcfg.c */
+	snprintf(header, sizeof(header), "%s", argv[argc - 1]);
+	dot = strrchr(header, '.');
+	if((dot != NULL) && (strcmp(dot, ".c") == 0))
+	{
+		dot[1] = 'h';
+	}
+	else
+	{
+		strncat(header, ".h", sizeof(header) - strlen(header) - 1U);
+	}
+	output = fopen(header, "w");
+	if(output == NULL)
+	{
+		perror(header);
+		return 2;
+	}
+	CfgGen_EmitSymbols(output, configs, sets);
+	fclose(output);
+	return 0;
+}
+#endif /* PORT_CFGGEN_NO_MAIN */
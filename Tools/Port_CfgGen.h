@@ -0,0 +1,79 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_CfgGen.h
+ *
+ * Description: Header file for the host side configuration generator of the Port Driver.
+ *
+ * Author: Mazen Hekal
+ ******************************************************************************/
+
+#ifndef PORT_CFGGEN_H
+#define PORT_CFGGEN_H
+
+#include <stdio.h>
+
+#include "Port.h"
+
+/* Maximum length of the name of a configuration set, and maximum number of sets in one Port_PBcfg.c */
+#define CFGGEN_NAME_LENGTH      (64U)
+#define CFGGEN_MAX_SETS         (8U)
+
+/* Configuration being generated */
+typedef struct
+{
+	char Name[CFGGEN_NAME_LENGTH];
+	Port_ConfigPin Pins[PORT_CONFIGURED_PINS];
+	uint16 Lines[PORT_CONFIGURED_PINS];
+	uint8 NumberOfPins;
+	Port_PortImageType Ports[PORT_NUMBER_OF_PORTS];
+	Port_ConfigPin SafePins[PORT_CONFIGURED_PINS];    /* Safe state of the pins given by SAFE lines */
+	uint16 SafeLines[PORT_CONFIGURED_PINS];
+	uint8 NumberOfSafePins;
+	Port_PortImageType Safe[PORT_NUMBER_OF_PORTS];
+	uint8 clock_Mask;
+	uint8 ahb_Mask;
+}CfgGen_ConfigType;
+
+/* Parses one line of the pin description, returns 0 on success */
+int CfgGen_ParsePin(const char * Line, uint16 LineNumber, Port_ConfigPin * Pin);
+
+/* Parses an AHB line listing the ports accessed through the AHB aperture, returns 0 on success */
+int CfgGen_ParseAhb(const char * Line, uint16 LineNumber, uint8 * AhbMask);
+
+/* Parses a NAME line giving the C identifier of the configuration set, returns 0 on success */
+int CfgGen_ParseName(const char * Line, uint16 LineNumber, char * Name);
+
+/* Parses a SAFE line giving the direction, resistor and level of a pin in the safe state, returns 0 on success */
+int CfgGen_ParseSafe(const char * Line, uint16 LineNumber, Port_ConfigPin * Safe);
+
+/* Rejects JTAG pins, pins that do not exist, modes the pin does not support and slew rate control without
+ * the 8-mA drive, returns 0 on success */
+int CfgGen_ValidatePin(const Port_ConfigPin * Pin, uint16 LineNumber);
+
+/* Rejects a pin that is already part of the configuration, returns 0 on success */
+int CfgGen_FindDuplicate(const CfgGen_ConfigType * Config, const Port_ConfigPin * Pin, uint16 LineNumber);
+
+/* Folds the drive strength, open drain and slew rate control of one pin into the register image of its port */
+void CfgGen_FoldPad(Port_PortImageType * Image, const Port_ConfigPin * Pin);
+
+/* Folds the configuration of one pin into the register image of its port */
+void CfgGen_FoldPin(Port_PortImageType * Image, const Port_ConfigPin * Pin);
+
+/* Folds the safe state of one pin into the safe state image of its port */
+void CfgGen_FoldSafe(Port_PortImageType * Image, const Port_ConfigPin * Safe);
+
+/* Reads, validates and folds a whole pin description file, returns 0 on success */
+int CfgGen_Read(FILE * Input, CfgGen_ConfigType * Config);
+
+/* Writes the Port_PBcfg.c source file of validated configuration sets, the first one is Port_Configuration */
+void CfgGen_Emit(FILE * Output, const CfgGen_ConfigType * Configs, uint8 NumberOfConfigs);
+
+/* Rejects configuration sets that give a Port Pin ID to another pin than the first set, returns 0 on success */
+int CfgGen_MatchPinIds(const CfgGen_ConfigType * Configs, uint8 NumberOfConfigs);
+
+/* Writes the Port_PBcfg.h header of the symbolic Port Pin IDs and of their changeable direction and mode */
+void CfgGen_EmitSymbols(FILE * Output, const CfgGen_ConfigType * Configs, uint8 NumberOfConfigs);
+
+#endif /* PORT_CFGGEN_H */
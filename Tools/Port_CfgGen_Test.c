@@ -0,0 +1,348 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_CfgGen_Test.c
+ *
+ * Description: Host test of the pin description parser, validation and register image folding
+ *              of Port_CfgGen.c. Runs good and bad pin lines through CfgGen_ParsePin, CfgGen_ValidatePin
+ *              and CfgGen_FindDuplicate and checks their result codes, folds known pins with
+ *              CfgGen_FoldPin, CfgGen_FoldPad and CfgGen_FoldSafe and compares the images with hand
+ *              computed ones, then reads a whole pin description with CfgGen_Read. The rejections
+ *              print their messages to stderr.
+ *
+ *              Build (from Tools):
+ *                cc -DPORT_CFGGEN_NO_MAIN -I.. -I. -I<AUTOSAR include path> Port_CfgGen_Test.c Port_CfgGen.c -o Port_CfgGen_Test
+ *              Usage: Port_CfgGen_Test [<pin description>], exits with 0 when every case passes. The pin
+ *              description defaults to the Port_Pins.cfg next to this source file
+ *
+ * Author: Mazen Hekal
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Port_CfgGen.h"
+
+/* Result codes of the parser and validation functions */
+#define TEST_OK          (0)
+#define TEST_REJECTED    (-1)
+
+/* Structure Type to hold one pin line and the results expected from its parsing and validation */
+typedef struct
+{
+	const char * Line;
+	int Parse;
+	int Validate;      /* Only checked when the line parses */
+}Test_PinCaseType;
+
+static const Test_PinCaseType Test_PinCases[] =
+{
+	/* Good lines */
+	{ "PA0 IN PULL_UP HIGH DIO TRUE TRUE",                          TEST_OK,       TEST_OK },
+	{ "PA1 OUT OFF LOW ALT01 FALSE FALSE",                          TEST_OK,       TEST_OK },
+	{ "PE3 IN OFF LOW ANALOG TRUE TRUE",                            TEST_OK,       TEST_OK },
+	{ "PF1 OUT OFF LOW ALT14 TRUE TRUE DRIVE_8MA SLEW OPEN_DRAIN",  TEST_OK,       TEST_OK },
+	{ "PC4 OUT OFF HIGH DIO TRUE TRUE DRIVE_4MA",                   TEST_OK,       TEST_OK },
+	/* JTAG pins PC0 to PC3 */
+	{ "PC0 IN OFF LOW DIO TRUE TRUE",                               TEST_OK,       TEST_REJECTED },
+	{ "PC3 OUT OFF LOW DIO TRUE TRUE",                              TEST_OK,       TEST_REJECTED },
+	/* Pins that are not bonded and pin names out of range */
+	{ "PE6 IN OFF LOW DIO TRUE TRUE",                               TEST_OK,       TEST_REJECTED },
+	{ "PF5 IN OFF LOW DIO TRUE TRUE",                               TEST_OK,       TEST_REJECTED },
+	{ "PG0 IN OFF LOW DIO TRUE TRUE",                               TEST_REJECTED, TEST_OK },
+	{ "PA8 IN OFF LOW DIO TRUE TRUE",                               TEST_REJECTED, TEST_OK },
+	/* Invalid alternate function numbers, and functions the pin does not support */
+	{ "PA0 IN OFF LOW ALT00 TRUE TRUE",                             TEST_REJECTED, TEST_OK },
+	{ "PA0 IN OFF LOW ALT15 TRUE TRUE",                             TEST_REJECTED, TEST_OK },
+	{ "PA0 IN OFF LOW ALT1 TRUE TRUE",                              TEST_REJECTED, TEST_OK },
+	{ "PA2 IN OFF LOW ALT01 TRUE TRUE",                             TEST_OK,       TEST_REJECTED },
+	{ "PA0 IN OFF LOW ANALOG TRUE TRUE",                            TEST_OK,       TEST_REJECTED },
+	/* Slew rate control without the 8-mA drive */
+	{ "PB6 OUT OFF LOW DIO TRUE TRUE SLEW",                         TEST_OK,       TEST_REJECTED },
+	{ "PB6 OUT OFF LOW DIO TRUE TRUE DRIVE_4MA SLEW",               TEST_OK,       TEST_REJECTED },
+	{ "PB6 OUT OFF LOW DIO TRUE TRUE DRIVE_8MA SLEW",               TEST_OK,       TEST_OK },
+	/* Pad settings of a pin in analog mode */
+	{ "PE3 IN OFF LOW ANALOG TRUE TRUE DRIVE_8MA",                  TEST_OK,       TEST_REJECTED },
+	{ "PE3 IN OFF LOW ANALOG TRUE TRUE OPEN_DRAIN",                 TEST_OK,       TEST_REJECTED },
+	/* Malformed lines */
+	{ "PA0 IN PULL_UP HIGH DIO TRUE",                               TEST_REJECTED, TEST_OK },
+	{ "PA0 INPUT PULL_UP HIGH DIO TRUE TRUE",                       TEST_REJECTED, TEST_OK },
+	{ "PA0 IN PULL_UP HIGH DIO TRUE TRUE DRIVE_12MA",               TEST_REJECTED, TEST_OK }
+};
+
+/* Register images a case folds its pin into */
+#define TEST_FOLD_PIN    (0U)
+#define TEST_FOLD_SAFE   (1U)
+
+/* Structure Type to hold one pin folded into an empty port register image and the image expected.
+ * Pad is a second line of the same pin folded with CfgGen_FoldPad over the first one, or NULL */
+typedef struct
+{
+	const char * Line;
+	const char * Pad;
+	uint8 Fold;
+	uint32 Mask[PORT_IMAGE_REGS];
+	uint32 Value[PORT_IMAGE_REGS];
+	uint8 CommitMask;
+}Test_FoldCaseType;
+
+static const Test_FoldCaseType Test_FoldCases[] =
+{
+	/* DIO output driven high, PF0 is a locked pin */
+	{ "PF0 OUT OFF HIGH DIO TRUE TRUE", NULL, TEST_FOLD_PIN,
+		{ [PORT_IMAGE_DATA] = 0x01, [PORT_IMAGE_CTL] = 0x0000000F, [PORT_IMAGE_ALT_FUNC] = 0x01, [PORT_IMAGE_ANALOG_MODE_SEL] = 0x01,
+		  [PORT_IMAGE_DIGITAL_ENABLE] = 0x01, [PORT_IMAGE_DIR] = 0x01, [PORT_IMAGE_DRIVE_2MA] = 0x01, [PORT_IMAGE_OPEN_DRAIN] = 0x01,
+		  [PORT_IMAGE_SLEW_RATE] = 0x01 },
+		{ [PORT_IMAGE_DATA] = 0x01, [PORT_IMAGE_DIGITAL_ENABLE] = 0x01, [PORT_IMAGE_DIR] = 0x01, [PORT_IMAGE_DRIVE_2MA] = 0x01 },
+		0x01 },
+	/* Alternate function 2 (U1Rx) in the PCTL nibble of pin 4, no internal resistor */
+	{ "PC4 IN OFF LOW ALT02 TRUE TRUE", NULL, TEST_FOLD_PIN,
+		{ [PORT_IMAGE_CTL] = 0x000F0000, [PORT_IMAGE_ALT_FUNC] = 0x10, [PORT_IMAGE_ANALOG_MODE_SEL] = 0x10,
+		  [PORT_IMAGE_DIGITAL_ENABLE] = 0x10, [PORT_IMAGE_PULL_UP] = 0x10, [PORT_IMAGE_PULL_DOWN] = 0x10, [PORT_IMAGE_DIR] = 0x10,
+		  [PORT_IMAGE_DRIVE_2MA] = 0x10, [PORT_IMAGE_OPEN_DRAIN] = 0x10, [PORT_IMAGE_SLEW_RATE] = 0x10 },
+		{ [PORT_IMAGE_CTL] = 0x00020000, [PORT_IMAGE_ALT_FUNC] = 0x10, [PORT_IMAGE_DIGITAL_ENABLE] = 0x10,
+		  [PORT_IMAGE_DRIVE_2MA] = 0x10 },
+		0x00 },
+	/* Alternate function 14 with the 8-mA drive, slew rate control and open drain */
+	{ "PF1 OUT OFF LOW ALT14 TRUE TRUE DRIVE_8MA SLEW OPEN_DRAIN", NULL, TEST_FOLD_PIN,
+		{ [PORT_IMAGE_DATA] = 0x02, [PORT_IMAGE_CTL] = 0x000000F0, [PORT_IMAGE_ALT_FUNC] = 0x02, [PORT_IMAGE_ANALOG_MODE_SEL] = 0x02,
+		  [PORT_IMAGE_DIGITAL_ENABLE] = 0x02, [PORT_IMAGE_DIR] = 0x02, [PORT_IMAGE_DRIVE_8MA] = 0x02, [PORT_IMAGE_OPEN_DRAIN] = 0x02,
+		  [PORT_IMAGE_SLEW_RATE] = 0x02 },
+		{ [PORT_IMAGE_CTL] = 0x000000E0, [PORT_IMAGE_ALT_FUNC] = 0x02, [PORT_IMAGE_DIGITAL_ENABLE] = 0x02, [PORT_IMAGE_DIR] = 0x02,
+		  [PORT_IMAGE_DRIVE_8MA] = 0x02, [PORT_IMAGE_OPEN_DRAIN] = 0x02, [PORT_IMAGE_SLEW_RATE] = 0x02 },
+		0x00 },
+	/* Analog input, AFSEL and PCTL are left as they are */
+	{ "PE3 IN OFF LOW ANALOG TRUE TRUE", NULL, TEST_FOLD_PIN,
+		{ [PORT_IMAGE_ANALOG_MODE_SEL] = 0x08, [PORT_IMAGE_DIGITAL_ENABLE] = 0x08, [PORT_IMAGE_PULL_UP] = 0x08,
+		  [PORT_IMAGE_PULL_DOWN] = 0x08, [PORT_IMAGE_DIR] = 0x08, [PORT_IMAGE_DRIVE_2MA] = 0x08, [PORT_IMAGE_OPEN_DRAIN] = 0x08,
+		  [PORT_IMAGE_SLEW_RATE] = 0x08 },
+		{ [PORT_IMAGE_ANALOG_MODE_SEL] = 0x08, [PORT_IMAGE_DRIVE_2MA] = 0x08 },
+		0x00 },
+	/* DIO input with the pull-down, the hardware clears the pull-up itself */
+	{ "PD2 IN PULL_DOWN LOW DIO TRUE TRUE", NULL, TEST_FOLD_PIN,
+		{ [PORT_IMAGE_CTL] = 0x00000F00, [PORT_IMAGE_ALT_FUNC] = 0x04, [PORT_IMAGE_ANALOG_MODE_SEL] = 0x04,
+		  [PORT_IMAGE_DIGITAL_ENABLE] = 0x04, [PORT_IMAGE_PULL_DOWN] = 0x04, [PORT_IMAGE_DIR] = 0x04, [PORT_IMAGE_DRIVE_2MA] = 0x04,
+		  [PORT_IMAGE_OPEN_DRAIN] = 0x04, [PORT_IMAGE_SLEW_RATE] = 0x04 },
+		{ [PORT_IMAGE_DIGITAL_ENABLE] = 0x04, [PORT_IMAGE_PULL_DOWN] = 0x04, [PORT_IMAGE_DRIVE_2MA] = 0x04 },
+		0x00 },
+	/* DIO input with the pull-up on the locked pin PD7 */
+	{ "PD7 IN PULL_UP HIGH DIO TRUE TRUE", NULL, TEST_FOLD_PIN,
+		{ [PORT_IMAGE_CTL] = 0xF0000000, [PORT_IMAGE_ALT_FUNC] = 0x80, [PORT_IMAGE_ANALOG_MODE_SEL] = 0x80,
+		  [PORT_IMAGE_DIGITAL_ENABLE] = 0x80, [PORT_IMAGE_PULL_UP] = 0x80, [PORT_IMAGE_DIR] = 0x80, [PORT_IMAGE_DRIVE_2MA] = 0x80,
+		  [PORT_IMAGE_OPEN_DRAIN] = 0x80, [PORT_IMAGE_SLEW_RATE] = 0x80 },
+		{ [PORT_IMAGE_DIGITAL_ENABLE] = 0x80, [PORT_IMAGE_PULL_UP] = 0x80, [PORT_IMAGE_DRIVE_2MA] = 0x80 },
+		0x80 },
+	/* DIO output with the 8-mA drive and slew rate control */
+	{ "PB6 OUT OFF LOW DIO TRUE TRUE DRIVE_8MA SLEW", NULL, TEST_FOLD_PIN,
+		{ [PORT_IMAGE_DATA] = 0x40, [PORT_IMAGE_CTL] = 0x0F000000, [PORT_IMAGE_ALT_FUNC] = 0x40, [PORT_IMAGE_ANALOG_MODE_SEL] = 0x40,
+		  [PORT_IMAGE_DIGITAL_ENABLE] = 0x40, [PORT_IMAGE_DIR] = 0x40, [PORT_IMAGE_DRIVE_8MA] = 0x40, [PORT_IMAGE_OPEN_DRAIN] = 0x40,
+		  [PORT_IMAGE_SLEW_RATE] = 0x40 },
+		{ [PORT_IMAGE_DIGITAL_ENABLE] = 0x40, [PORT_IMAGE_DIR] = 0x40, [PORT_IMAGE_DRIVE_8MA] = 0x40, [PORT_IMAGE_SLEW_RATE] = 0x40 },
+		0x00 },
+	/* The same pin refolded with the 4-mA drive, which replaces the 8-mA drive and the slew rate control */
+	{ "PB6 OUT OFF LOW DIO TRUE TRUE DRIVE_8MA SLEW", "PB6 OUT OFF LOW DIO TRUE TRUE DRIVE_4MA", TEST_FOLD_PIN,
+		{ [PORT_IMAGE_DATA] = 0x40, [PORT_IMAGE_CTL] = 0x0F000000, [PORT_IMAGE_ALT_FUNC] = 0x40, [PORT_IMAGE_ANALOG_MODE_SEL] = 0x40,
+		  [PORT_IMAGE_DIGITAL_ENABLE] = 0x40, [PORT_IMAGE_DIR] = 0x40, [PORT_IMAGE_DRIVE_4MA] = 0x40, [PORT_IMAGE_OPEN_DRAIN] = 0x40,
+		  [PORT_IMAGE_SLEW_RATE] = 0x40 },
+		{ [PORT_IMAGE_DIGITAL_ENABLE] = 0x40, [PORT_IMAGE_DIR] = 0x40, [PORT_IMAGE_DRIVE_4MA] = 0x40 },
+		0x00 },
+	/* Safe state output driven high */
+	{ "SAFE PA2 OUT OFF HIGH", NULL, TEST_FOLD_SAFE,
+		{ [PORT_IMAGE_DATA] = 0x04, [PORT_IMAGE_CTL] = 0x00000F00, [PORT_IMAGE_ALT_FUNC] = 0x04, [PORT_IMAGE_ANALOG_MODE_SEL] = 0x04,
+		  [PORT_IMAGE_DIGITAL_ENABLE] = 0x04, [PORT_IMAGE_PULL_UP] = 0x04, [PORT_IMAGE_PULL_DOWN] = 0x04, [PORT_IMAGE_DIR] = 0x04 },
+		{ [PORT_IMAGE_DATA] = 0x04, [PORT_IMAGE_DIGITAL_ENABLE] = 0x04, [PORT_IMAGE_DIR] = 0x04 },
+		0x00 },
+	/* Safe state input with the pull-down and the digital function disabled */
+	{ "SAFE PE3 IN PULL_DOWN LOW", NULL, TEST_FOLD_SAFE,
+		{ [PORT_IMAGE_CTL] = 0x0000F000, [PORT_IMAGE_ALT_FUNC] = 0x08, [PORT_IMAGE_ANALOG_MODE_SEL] = 0x08,
+		  [PORT_IMAGE_DIGITAL_ENABLE] = 0x08, [PORT_IMAGE_PULL_UP] = 0x08, [PORT_IMAGE_PULL_DOWN] = 0x08, [PORT_IMAGE_DIR] = 0x08 },
+		{ [PORT_IMAGE_PULL_DOWN] = 0x08 },
+		0x00 }
+};
+
+/* Register names of a port register image, for the messages */
+static const char * const Test_RegNames[PORT_IMAGE_REGS] =
+{
+	"GPIODATA", "GPIOPCTL", "GPIOAFSEL", "GPIOAMSEL", "GPIODEN", "GPIOPUR", "GPIOPDR", "GPIODIR",
+	"GPIODR2R", "GPIODR4R", "GPIODR8R", "GPIOODR", "GPIOSLR"
+};
+
+/* Number of failed checks */
+static unsigned int Test_Failures;
+
+static void Test_Check(const char * What, const char * Line, int Result, int Expected)
+{
+	if(Result != Expected)
+	{
+		printf("  FAIL: %s of '%s' returned %d, expected %d\n", What, Line, Result, Expected);
+		Test_Failures++;
+	}
+}
+
+/* Every pin line parses and validates as expected */
+static void Test_PinLines(void)
+{
+	for(unsigned int i = 0; i < sizeof(Test_PinCases) / sizeof(Test_PinCases[0]); i++)
+	{
+		const Test_PinCaseType * Case = &Test_PinCases[i];
+		Port_ConfigPin pin;
+		int result;
+
+		memset(&pin, 0, sizeof(pin));
+		result = CfgGen_ParsePin(Case->Line, (uint16)(i + 1U), &pin);
+		Test_Check("CfgGen_ParsePin", Case->Line, result, Case->Parse);
+		if(result == TEST_OK)
+		{
+			Test_Check("CfgGen_ValidatePin", Case->Line, CfgGen_ValidatePin(&pin, (uint16)(i + 1U)), Case->Validate);
+		}
+	}
+}
+
+/* A pin is rejected once it is part of the configuration, another pin of its port is not */
+static void Test_Duplicate(void)
+{
+	static CfgGen_ConfigType config;
+	Port_ConfigPin pin;
+
+	memset(&config, 0, sizeof(config));
+	if(CfgGen_ParsePin("PB2 IN PULL_UP HIGH DIO TRUE TRUE", 1, &config.Pins[0]) != TEST_OK)
+	{
+		printf("  FAIL: PB2 does not parse\n");
+		Test_Failures++;
+		return;
+	}
+	config.Lines[0] = 1;
+	config.NumberOfPins = 1;
+
+	CfgGen_ParsePin("PB2 OUT OFF LOW ALT03 TRUE TRUE", 2, &pin);
+	Test_Check("CfgGen_FindDuplicate", "PB2 twice", CfgGen_FindDuplicate(&config, &pin, 2), TEST_REJECTED);
+	CfgGen_ParsePin("PB3 OUT OFF LOW ALT03 TRUE TRUE", 3, &pin);
+	Test_Check("CfgGen_FindDuplicate", "PB3 after PB2", CfgGen_FindDuplicate(&config, &pin, 3), TEST_OK);
+}
+
+/* Every pin folds into the register image computed by hand */
+static void Test_Fold(void)
+{
+	for(unsigned int i = 0; i < sizeof(Test_FoldCases) / sizeof(Test_FoldCases[0]); i++)
+	{
+		const Test_FoldCaseType * Case = &Test_FoldCases[i];
+		Port_PortImageType image;
+		Port_ConfigPin pin;
+		int result;
+
+		memset(&image, 0, sizeof(image));
+		memset(&pin, 0, sizeof(pin));
+		if(Case->Fold == TEST_FOLD_SAFE)
+		{
+			result = CfgGen_ParseSafe(Case->Line, (uint16)(i + 1U), &pin);
+			CfgGen_FoldSafe(&image, &pin);
+		}
+		else
+		{
+			result = CfgGen_ParsePin(Case->Line, (uint16)(i + 1U), &pin);
+			CfgGen_FoldPin(&image, &pin);
+		}
+		if((result == TEST_OK) && (Case->Pad != NULL))
+		{
+			result = CfgGen_ParsePin(Case->Pad, (uint16)(i + 1U), &pin);
+			CfgGen_FoldPad(&image, &pin);
+		}
+		Test_Check("Parsing", Case->Line, result, TEST_OK);
+
+		for(uint8 reg = 0; reg < PORT_IMAGE_REGS; reg++)
+		{
+			if((image.Regs[reg].mask != Case->Mask[reg]) || (image.Regs[reg].value != Case->Value[reg]))
+			{
+				printf("  FAIL: folding '%s' gave %s mask 0x%08lX value 0x%08lX, expected mask 0x%08lX value 0x%08lX\n",
+						Case->Line, Test_RegNames[reg], (unsigned long)image.Regs[reg].mask, (unsigned long)image.Regs[reg].value,
+						(unsigned long)Case->Mask[reg], (unsigned long)Case->Value[reg]);
+				Test_Failures++;
+			}
+		}
+		if(image.commit_Mask != Case->CommitMask)
+		{
+			printf("  FAIL: folding '%s' gave commit mask 0x%02X, expected 0x%02X\n", Case->Line,
+					(unsigned)image.commit_Mask, (unsigned)Case->CommitMask);
+			Test_Failures++;
+		}
+	}
+}
+
+/* CfgGen_Read accepts the shipped pin description and rejects one with a duplicate, a JTAG pin
+ * or a pin count other than PORT_CONFIGURED_PINS */
+static void Test_Read(const char * Path)
+{
+	static const struct
+	{
+		const char * Text;
+		int Expected;
+	}Files[] =
+	{
+		{ "NAME Test_Short\nPA0 IN PULL_UP HIGH DIO TRUE TRUE # comment\n\nPF4 OUT OFF LOW DIO TRUE TRUE DRIVE_8MA SLEW\n", TEST_REJECTED },
+		{ "PA0 IN PULL_UP HIGH DIO TRUE TRUE\nPA0 OUT OFF LOW DIO TRUE TRUE\n",                                         TEST_REJECTED },
+		{ "PA0 IN PULL_UP HIGH DIO TRUE TRUE\nPC2 OUT OFF LOW DIO TRUE TRUE\n",                                         TEST_REJECTED }
+	};
+	static CfgGen_ConfigType config;
+	FILE * input;
+
+	for(unsigned int i = 0; i < sizeof(Files) / sizeof(Files[0]); i++)
+	{
+		input = tmpfile();
+		if(input == NULL)
+		{
+			perror("tmpfile");
+			Test_Failures++;
+			return;
+		}
+		fputs(Files[i].Text, input);
+		rewind(input);
+		Test_Check("CfgGen_Read", Files[i].Text, (CfgGen_Read(input, &config) == 0) ? TEST_OK : TEST_REJECTED, Files[i].Expected);
+		fclose(input);
+	}
+
+	/* The shipped description */
+	input = fopen(Path, "r");
+	if(input == NULL)
+	{
+		perror(Path);
+		Test_Failures++;
+		return;
+	}
+	Test_Check("CfgGen_Read", Path, (CfgGen_Read(input, &config) == 0) ? TEST_OK : TEST_REJECTED, TEST_OK);
+	fclose(input);
+	if(config.NumberOfPins != PORT_CONFIGURED_PINS)
+	{
+		printf("  FAIL: CfgGen_Read of '%s' gave %u pins\n", Path, config.NumberOfPins);
+		Test_Failures++;
+	}
+}
+
+int main(int argc, char * argv[])
+{
+	char path[FILENAME_MAX] = "";
+	const char * separator = strrchr(__FILE__, '/');
+
+	if(argc > 1)
+	{
+		snprintf(path, sizeof(path), "%s", argv[1]);
+	}
+	else
+	{
+		/* Port_Pins.cfg lives next to this source file, whatever the working directory */
+		int length = (separator != NULL) ? (int)(separator - __FILE__ + 1) : 0;
+		snprintf(path, sizeof(path), "%.*sPort_Pins.cfg", length, __FILE__);
+	}
+
+	Test_PinLines();
+	Test_Duplicate();
+	Test_Fold();
+	Test_Read(path);
+	if(Test_Failures != 0)
+	{
+		printf("FAIL: %u check(s) failed\n", Test_Failures);
+		return 1;
+	}
+	printf("PASS: 0 check(s) failed\n");
+	return 0;
+}
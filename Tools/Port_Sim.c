@@ -0,0 +1,622 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Sim.c
+ *
+ * Description: Host register model of the TM4C123GH6PM GPIO ports and System Control block.
+ *              Every load and store of the driver is counted per register and per API call,
+ *              and the GPIOLOCK/GPIOCR commit protection of PC0-PC3, PD7 and PF0 is enforced.
+ *              Every port is reachable through the aperture GPIOHBCTL selects for it, APB or AHB,
+ *              and the accesses are charged the bus cycles of that aperture. Stores and loads to the
+ *              peripheral bit-band alias are applied to the single bit they map to.
+ *              Host threads may access the model concurrently, the accesses are served one at a
+ *              time like on the single bus of the device, and a compare and swap models the
+ *              load-exclusive/store-exclusive pair of the Cortex-M4. A stress test may have every
+ *              load and store give up the processor, so that another thread runs between a load
+ *              and the store that depends on it, as an interrupt or a higher priority task would.
+ *
+ *              Build the driver with -DPORT_HOST_SIMULATION=STD_ON -ITools and link this file.
+ *
+ * Author: Mazen Hekal
+ ******************************************************************************/
+
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "Port.h"
+#include "Port_Regs.h"
+#include "Port_Sim.h"
+
+/* System Control block base address */
+#define PORT_SIM_SYSCTL_BASE_ADDRESS    0x400FE000
+
+/* Size of one register block */
+#define PORT_SIM_BLOCK_SIZE             (PORT_SIM_BLOCK_WORDS * 4U)
+
+/* Highest offset of the GPIODATA aperture, address bits [9:2] select the accessed pins */
+#define PORT_SIM_DATA_LAST_OFFSET       PORT_DATA_REG_OFFSET
+
+/* Value read from GPIOLOCK while the GPIOCR register is locked */
+#define PORT_SIM_LOCKED                 (1U)
+
+/* Size of the peripheral bit-band alias, 32 alias words for every word of the 1MB bit-band region */
+#define PORT_SIM_ALIAS_SIZE             (0x02000000U)
+
+/* Block index used for an address that is not modelled */
+#define PORT_SIM_NO_BLOCK               (0xFFU)
+
+/* Structure Type to hold the state of one register block */
+typedef struct
+{
+	uint32 Regs[PORT_SIM_BLOCK_WORDS];
+	uint32 Data;
+	boolean Unlocked;
+	Port_Sim_CountType Count[PORT_SIM_BLOCK_WORDS];
+}Port_Sim_BlockType;
+
+/* Structure Type to hold the accumulated accesses of one API */
+typedef struct
+{
+	const char * Name;
+	uint32 Calls;
+	Port_Sim_CountType Count;
+}Port_Sim_CallType;
+
+/* Base addresses of the modelled blocks */
+static const uint32 Port_Sim_BaseAddress[PORT_SIM_BLOCKS] =
+{
+	GPIO_PORTA_BASE_ADDRESS, GPIO_PORTB_BASE_ADDRESS, GPIO_PORTC_BASE_ADDRESS,
+	GPIO_PORTD_BASE_ADDRESS, GPIO_PORTE_BASE_ADDRESS, GPIO_PORTF_BASE_ADDRESS,
+	PORT_SIM_SYSCTL_BASE_ADDRESS
+};
+
+/* AHB aperture base addresses of the GPIO ports */
+static const uint32 Port_Sim_AhbBaseAddress[PORT_NUMBER_OF_PORTS] =
+{
+	GPIO_PORTA_AHB_BASE_ADDRESS, GPIO_PORTB_AHB_BASE_ADDRESS, GPIO_PORTC_AHB_BASE_ADDRESS,
+	GPIO_PORTD_AHB_BASE_ADDRESS, GPIO_PORTE_AHB_BASE_ADDRESS, GPIO_PORTF_AHB_BASE_ADDRESS
+};
+
+/* GPIOCR reset values, 0 bits are the pins protected by the lock */
+static const uint8 Port_Sim_CommitReset[PORT_NUMBER_OF_PORTS] = { 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFE };
+
+static Port_Sim_BlockType Port_Sim_Blocks[PORT_SIM_BLOCKS];
+static Port_Sim_CountType Port_Sim_Total;
+static uint32 Port_Sim_Faults;
+static Port_Sim_ClockType Port_Sim_Clocks;
+static Port_Sim_CallType Port_Sim_Calls[PORT_SIM_MAX_CALLS];
+static Port_Sim_CallType * Port_Sim_CurrentCall = NULL;
+static Port_Sim_CountType Port_Sim_CallStart;
+
+/* Held while one access is served, so concurrent host threads never see half of an access */
+static char Port_Sim_Bus;
+
+/* Set when every load and store yields the processor outside of the bus lock */
+static boolean Port_Sim_Yield = FALSE;
+
+/************************************************************************************
+ * Function Name: Port_Sim_Decode
+ * Description: Finds the block and the register offset an address belongs to and whether
+ *              the address is inside the AHB aperture of a GPIO port
+ ************************************************************************************/
+static uint8 Port_Sim_Decode(uint32 Address, uint32 * Offset, boolean * Ahb)
+{
+	*Ahb = FALSE;
+	for(uint8 block = 0; block < PORT_SIM_BLOCKS; block++)
+	{
+		if((Address >= Port_Sim_BaseAddress[block]) && (Address < (Port_Sim_BaseAddress[block] + PORT_SIM_BLOCK_SIZE)))
+		{
+			*Offset = (Address - Port_Sim_BaseAddress[block]) & ~(uint32)3;
+			return block;
+		}
+	}
+	for(uint8 block = 0; block < PORT_NUMBER_OF_PORTS; block++)
+	{
+		if((Address >= Port_Sim_AhbBaseAddress[block]) && (Address < (Port_Sim_AhbBaseAddress[block] + PORT_SIM_BLOCK_SIZE)))
+		{
+			*Offset = (Address - Port_Sim_AhbBaseAddress[block]) & ~(uint32)3;
+			*Ahb = TRUE;
+			return block;
+		}
+	}
+	return PORT_SIM_NO_BLOCK;
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_SysctlReg
+ * Description: Returns the current value of a System Control register
+ ************************************************************************************/
+static uint32 Port_Sim_SysctlReg(uint32 Address)
+{
+	return Port_Sim_Blocks[PORT_SIM_SYSCTL_BLOCK].Regs[(Address - PORT_SIM_SYSCTL_BASE_ADDRESS) / 4U];
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_Accessible
+ * Description: Checks the block exists and, for a GPIO port, that its clock is running
+ *              and that it is accessed through the aperture selected in GPIOHBCTL
+ ************************************************************************************/
+static boolean Port_Sim_Accessible(uint8 Block, boolean Ahb)
+{
+	if(Block == PORT_SIM_NO_BLOCK)
+	{
+		return FALSE;
+	}
+	if(Block == PORT_SIM_SYSCTL_BLOCK)
+	{
+		return TRUE;
+	}
+	if(((Port_Sim_SysctlReg(SYSCTL_GPIOHBCTL_ADDRESS) & (1U << Block)) ? TRUE : FALSE) != Ahb)
+	{
+		return FALSE;
+	}
+	return (Port_Sim_SysctlReg(SYSCTL_REGCGC2_ADDRESS) & (1U << Block)) ? TRUE : FALSE;
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_Load
+ * Description: Returns the value a load from a mapped register gives
+ ************************************************************************************/
+static uint32 Port_Sim_Load(uint8 Block, uint32 Offset)
+{
+	Port_Sim_BlockType * block = &Port_Sim_Blocks[Block];
+
+	if(Block == PORT_SIM_SYSCTL_BLOCK)
+	{
+		if(Offset == (SYSCTL_PRGPIO_ADDRESS - PORT_SIM_SYSCTL_BASE_ADDRESS))
+		{
+			/* A port is ready as soon as its clock is enabled */
+			return Port_Sim_SysctlReg(SYSCTL_REGCGC2_ADDRESS) & SYSCTL_GPIOHBCTL_PORTS_MASK;
+		}
+		return block->Regs[Offset / 4U];
+	}
+	if(Offset <= PORT_SIM_DATA_LAST_OFFSET)
+	{
+		return block->Data & (Offset >> 2);
+	}
+	if(Offset == PORT_LOCK_REG_OFFSET)
+	{
+		return block->Unlocked ? 0U : PORT_SIM_LOCKED;
+	}
+	return block->Regs[Offset / 4U];
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_Store
+ * Description: Applies a store to a mapped register with the hardware side effects
+ ************************************************************************************/
+static void Port_Sim_Store(uint8 Block, uint32 Offset, uint32 Value)
+{
+	Port_Sim_BlockType * block = &Port_Sim_Blocks[Block];
+	uint32 * reg = &block->Regs[Offset / 4U];
+	uint32 writable;
+
+	if(Block == PORT_SIM_SYSCTL_BLOCK)
+	{
+		if(Offset == (SYSCTL_REGCGC2_ADDRESS - PORT_SIM_SYSCTL_BASE_ADDRESS))
+		{
+			/* Count the port clocks started and stopped by the store */
+			for(uint32 changed = (*reg ^ Value) & SYSCTL_GPIOHBCTL_PORTS_MASK; changed != 0; changed &= changed - 1U)
+			{
+				uint32 port_Bit = changed & (~changed + 1U);
+				if(Value & port_Bit)
+				{
+					Port_Sim_Clocks.Enables++;
+				}
+				else
+				{
+					Port_Sim_Clocks.Gates++;
+				}
+			}
+			Port_Sim_Clocks.Writes++;
+		}
+		*reg = Value;
+		return;
+	}
+	if(Offset <= PORT_SIM_DATA_LAST_OFFSET)
+	{
+		uint32 mask = Offset >> 2;
+		block->Data = (block->Data & ~mask) | (Value & mask);
+		return;
+	}
+	switch(Offset)
+	{
+	case PORT_LOCK_REG_OFFSET:
+		block->Unlocked = (Value == PORT_LOCK_KEY) ? TRUE : FALSE;
+		break;
+	case PORT_COMMIT_REG_OFFSET:
+		if(block->Unlocked)
+		{
+			*reg = Value & 0xFFU;
+		}
+		break;
+	case PORT_ALT_FUNC_REG_OFFSET:
+	case PORT_PULL_UP_REG_OFFSET:
+	case PORT_PULL_DOWN_REG_OFFSET:
+	case PORT_DIGITAL_ENABLE_REG_OFFSET:
+		/* Only the bits enabled in GPIOCR can be changed */
+		writable = block->Regs[PORT_COMMIT_REG_OFFSET / 4U];
+		*reg = (*reg & ~writable) | (Value & writable & 0xFFU);
+		if(Offset == PORT_PULL_UP_REG_OFFSET)
+		{
+			block->Regs[PORT_PULL_DOWN_REG_OFFSET / 4U] &= ~(Value & writable);  /* Enabling a pull up disables the pull down */
+		}
+		else if(Offset == PORT_PULL_DOWN_REG_OFFSET)
+		{
+			block->Regs[PORT_PULL_UP_REG_OFFSET / 4U] &= ~(Value & writable);    /* Enabling a pull down disables the pull up */
+		}
+		break;
+	case PORT_CTL_REG_OFFSET:
+		*reg = Value;
+		break;
+	case PORT_DRIVE_2MA_REG_OFFSET:
+	case PORT_DRIVE_4MA_REG_OFFSET:
+	case PORT_DRIVE_8MA_REG_OFFSET:
+		/* Setting a pin in one drive select register clears it in the two others */
+		block->Regs[PORT_DRIVE_2MA_REG_OFFSET / 4U] &= ~Value;
+		block->Regs[PORT_DRIVE_4MA_REG_OFFSET / 4U] &= ~Value;
+		block->Regs[PORT_DRIVE_8MA_REG_OFFSET / 4U] &= ~Value;
+		*reg = Value & 0xFFU;
+		break;
+	default:
+		*reg = Value & 0xFFU;
+		break;
+	}
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_Charge
+ * Description: Adds the bus cycles of one access through the given aperture
+ ************************************************************************************/
+static void Port_Sim_Charge(Port_Sim_CountType * Count, boolean Ahb)
+{
+	uint32 cycles = Ahb ? PORT_SIM_AHB_ACCESS_CYCLES : PORT_SIM_APB_ACCESS_CYCLES;
+
+	Count->Cycles += cycles;
+	Port_Sim_Total.Cycles += cycles;
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_Unalias
+ * Description: Maps an address of the peripheral bit-band alias to the word and bit it
+ *              stands for, returns FALSE for an address outside the alias
+ ************************************************************************************/
+static boolean Port_Sim_Unalias(uint32 * Address, uint8 * Bit)
+{
+	uint32 alias_Offset;
+
+	if((*Address < PORT_BITBAND_ALIAS_BASE) || (*Address >= (PORT_BITBAND_ALIAS_BASE + PORT_SIM_ALIAS_SIZE)))
+	{
+		return FALSE;
+	}
+	alias_Offset = *Address - PORT_BITBAND_ALIAS_BASE;
+	*Address = PORT_BITBAND_PERIPH_BASE + ((alias_Offset >> 5) & ~(uint32)3);
+	*Bit = (uint8)((alias_Offset >> 2) & 31U);
+	return TRUE;
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_LockBus / Port_Sim_UnlockBus
+ * Description: Serialize the accesses of concurrent host threads
+ ************************************************************************************/
+static void Port_Sim_LockBus(void)
+{
+	while(__atomic_test_and_set(&Port_Sim_Bus, __ATOMIC_ACQUIRE))
+	{
+		/* Another thread is accessing the bus */
+	}
+}
+
+static void Port_Sim_UnlockBus(void)
+{
+	__atomic_clear(&Port_Sim_Bus, __ATOMIC_RELEASE);
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_BusRead
+ * Description: Serves and counts one load of the driver, the bus is held by the caller
+ ************************************************************************************/
+static uint32 Port_Sim_BusRead(uint32 Address)
+{
+	uint32 offset = 0;
+	boolean ahb = FALSE;
+	uint8 bit = 0;
+	boolean alias = Port_Sim_Unalias(&Address, &bit);
+	uint8 block = Port_Sim_Decode(Address, &offset, &ahb);
+
+	if(!Port_Sim_Accessible(block, ahb))
+	{
+		Port_Sim_Faults++;
+		return 0;
+	}
+	Port_Sim_Blocks[block].Count[offset / 4U].Loads++;
+	Port_Sim_Total.Loads++;
+	Port_Sim_Charge(&Port_Sim_Blocks[block].Count[offset / 4U], ahb);
+	if(alias)
+	{
+		return (Port_Sim_Load(block, offset) >> bit) & 1U;
+	}
+	return Port_Sim_Load(block, offset);
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_BusWrite
+ * Description: Serves and counts one store of the driver, the bus is held by the caller
+ ************************************************************************************/
+static void Port_Sim_BusWrite(uint32 Address, uint32 Value)
+{
+	uint32 offset = 0;
+	boolean ahb = FALSE;
+	uint8 bit = 0;
+	boolean alias = Port_Sim_Unalias(&Address, &bit);
+	uint8 block = Port_Sim_Decode(Address, &offset, &ahb);
+
+	if(!Port_Sim_Accessible(block, ahb))
+	{
+		Port_Sim_Faults++;
+		return;
+	}
+	Port_Sim_Blocks[block].Count[offset / 4U].Stores++;
+	Port_Sim_Total.Stores++;
+	Port_Sim_Charge(&Port_Sim_Blocks[block].Count[offset / 4U], ahb);
+	if(alias)
+	{
+		/* The bus turns an alias store into an uninterruptible read-modify-write of the bit */
+		uint32 word = Port_Sim_Load(block, offset);
+		Port_Sim_Charge(&Port_Sim_Blocks[block].Count[offset / 4U], ahb);
+		Value = (Value & 1U) ? (word | ((uint32)1 << bit)) : (word & ~((uint32)1 << bit));
+	}
+	Port_Sim_Store(block, offset, Value);
+}
+
+uint32 Port_Sim_Read(uint32 Address)
+{
+	uint32 value;
+
+	Port_Sim_LockBus();
+	value = Port_Sim_BusRead(Address);
+	Port_Sim_UnlockBus();
+	if(__atomic_load_n(&Port_Sim_Yield, __ATOMIC_RELAXED) == TRUE)
+	{
+		/* Another thread runs between this load and the store the caller computes from it */
+		sched_yield();
+	}
+	return value;
+}
+
+void Port_Sim_Write(uint32 Address, uint32 Value)
+{
+	if(__atomic_load_n(&Port_Sim_Yield, __ATOMIC_RELAXED) == TRUE)
+	{
+		/* Another thread runs between the computation of Value and its store */
+		sched_yield();
+	}
+	Port_Sim_LockBus();
+	Port_Sim_BusWrite(Address, Value);
+	Port_Sim_UnlockBus();
+}
+
+boolean Port_Sim_CompareExchange(uint32 Address, uint32 * Expected, uint32 Desired)
+{
+	boolean exchanged;
+	uint32 value;
+
+	/* The load-exclusive and the store-exclusive with nothing else on the bus in between */
+	Port_Sim_LockBus();
+	value = Port_Sim_BusRead(Address);
+	exchanged = (value == *Expected) ? TRUE : FALSE;
+	if(exchanged == TRUE)
+	{
+		Port_Sim_BusWrite(Address, Desired);
+	}
+	else
+	{
+		*Expected = value;
+	}
+	Port_Sim_UnlockBus();
+	return exchanged;
+}
+
+void Port_Sim_SetYield(boolean Yield)
+{
+	__atomic_store_n(&Port_Sim_Yield, Yield, __ATOMIC_RELAXED);
+}
+
+void Port_Sim_Reset(void)
+{
+	memset(Port_Sim_Blocks, 0, sizeof(Port_Sim_Blocks));
+	memset(Port_Sim_Calls, 0, sizeof(Port_Sim_Calls));
+	Port_Sim_CurrentCall = NULL;
+	for(uint8 port = 0; port < PORT_NUMBER_OF_PORTS; port++)
+	{
+		Port_Sim_Blocks[port].Regs[PORT_COMMIT_REG_OFFSET / 4U] = Port_Sim_CommitReset[port];
+		/* Every pin comes out of reset with the 2-mA drive */
+		Port_Sim_Blocks[port].Regs[PORT_DRIVE_2MA_REG_OFFSET / 4U] = 0xFF;
+	}
+	/* PC0-PC3 come out of reset as the JTAG interface */
+	Port_Sim_Blocks[PORTC].Regs[PORT_ALT_FUNC_REG_OFFSET / 4U] = 0x0F;
+	Port_Sim_Blocks[PORTC].Regs[PORT_PULL_UP_REG_OFFSET / 4U] = 0x0F;
+	Port_Sim_Blocks[PORTC].Regs[PORT_DIGITAL_ENABLE_REG_OFFSET / 4U] = 0x0F;
+	Port_Sim_Blocks[PORTC].Regs[PORT_CTL_REG_OFFSET / 4U] = 0x00001111;
+	Port_Sim_ClearCounters();
+}
+
+void Port_Sim_ClearCounters(void)
+{
+	for(uint8 block = 0; block < PORT_SIM_BLOCKS; block++)
+	{
+		memset(Port_Sim_Blocks[block].Count, 0, sizeof(Port_Sim_Blocks[block].Count));
+	}
+	memset(&Port_Sim_Total, 0, sizeof(Port_Sim_Total));
+	memset(&Port_Sim_Clocks, 0, sizeof(Port_Sim_Clocks));
+	Port_Sim_Faults = 0;
+}
+
+uint32 Port_Sim_Peek(uint32 Address)
+{
+	uint32 offset = 0;
+	boolean ahb = FALSE;
+	uint8 block = Port_Sim_Decode(Address, &offset, &ahb);
+	uint32 value;
+
+	Port_Sim_LockBus();
+	value = (block == PORT_SIM_NO_BLOCK) ? 0U : Port_Sim_Load(block, offset);
+	Port_Sim_UnlockBus();
+	return value;
+}
+
+void Port_Sim_Poke(uint32 Address, uint32 Value)
+{
+	uint32 offset = 0;
+	boolean ahb = FALSE;
+	uint8 block = Port_Sim_Decode(Address, &offset, &ahb);
+
+	if(block == PORT_SIM_NO_BLOCK)
+	{
+		return;
+	}
+	Port_Sim_LockBus();
+	if((block != PORT_SIM_SYSCTL_BLOCK) && (offset <= PORT_SIM_DATA_LAST_OFFSET))
+	{
+		Port_Sim_Blocks[block].Data = Value;
+	}
+	else
+	{
+		Port_Sim_Blocks[block].Regs[offset / 4U] = Value;
+	}
+	Port_Sim_UnlockBus();
+}
+
+Port_Sim_CountType Port_Sim_GetTotal(void)
+{
+	return Port_Sim_Total;
+}
+
+Port_Sim_CountType Port_Sim_GetRegCount(uint32 Address)
+{
+	Port_Sim_CountType count = { 0, 0, 0 };
+	uint32 offset = 0;
+	boolean ahb = FALSE;
+	uint8 block = Port_Sim_Decode(Address, &offset, &ahb);
+
+	if(block != PORT_SIM_NO_BLOCK)
+	{
+		count = Port_Sim_Blocks[block].Count[offset / 4U];
+	}
+	return count;
+}
+
+Port_Sim_ClockType Port_Sim_GetClocks(void)
+{
+	return Port_Sim_Clocks;
+}
+
+uint32 Port_Sim_GetFaults(void)
+{
+	return Port_Sim_Faults;
+}
+
+void Port_Sim_BeginCall(const char * Name)
+{
+	Port_Sim_CurrentCall = NULL;
+	for(uint8 i = 0; i < PORT_SIM_MAX_CALLS; i++)
+	{
+		if((Port_Sim_Calls[i].Name == NULL) || (strcmp(Port_Sim_Calls[i].Name, Name) == 0))
+		{
+			Port_Sim_Calls[i].Name = Name;
+			Port_Sim_CurrentCall = &Port_Sim_Calls[i];
+			break;
+		}
+	}
+	Port_Sim_CallStart = Port_Sim_Total;
+}
+
+void Port_Sim_EndCall(void)
+{
+	if(Port_Sim_CurrentCall != NULL)
+	{
+		Port_Sim_CurrentCall->Calls++;
+		Port_Sim_CurrentCall->Count.Loads += Port_Sim_Total.Loads - Port_Sim_CallStart.Loads;
+		Port_Sim_CurrentCall->Count.Stores += Port_Sim_Total.Stores - Port_Sim_CallStart.Stores;
+		Port_Sim_CurrentCall->Count.Cycles += Port_Sim_Total.Cycles - Port_Sim_CallStart.Cycles;
+		Port_Sim_CurrentCall = NULL;
+	}
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_RegName
+ * Description: Returns the data sheet name of a register offset
+ ************************************************************************************/
+static const char * Port_Sim_RegName(uint8 Block, uint32 Offset)
+{
+	if(Block == PORT_SIM_SYSCTL_BLOCK)
+	{
+		if(Offset == (SYSCTL_GPIOHBCTL_ADDRESS - PORT_SIM_SYSCTL_BASE_ADDRESS))
+		{
+			return "GPIOHBCTL";
+		}
+		if(Offset == (SYSCTL_PRGPIO_ADDRESS - PORT_SIM_SYSCTL_BASE_ADDRESS))
+		{
+			return "PRGPIO";
+		}
+		return (Offset == (SYSCTL_REGCGC2_ADDRESS - PORT_SIM_SYSCTL_BASE_ADDRESS)) ? "RCGC2" : "SYSCTL";
+	}
+	if(Offset <= PORT_SIM_DATA_LAST_OFFSET)
+	{
+		return "GPIODATA";
+	}
+	switch(Offset)
+	{
+	case PORT_DIR_REG_OFFSET:               return "GPIODIR";
+	case PORT_ALT_FUNC_REG_OFFSET:          return "GPIOAFSEL";
+	case PORT_PULL_UP_REG_OFFSET:           return "GPIOPUR";
+	case PORT_PULL_DOWN_REG_OFFSET:         return "GPIOPDR";
+	case PORT_DIGITAL_ENABLE_REG_OFFSET:    return "GPIODEN";
+	case PORT_LOCK_REG_OFFSET:              return "GPIOLOCK";
+	case PORT_COMMIT_REG_OFFSET:            return "GPIOCR";
+	case PORT_ANALOG_MODE_SEL_REG_OFFSET:   return "GPIOAMSEL";
+	case PORT_CTL_REG_OFFSET:               return "GPIOPCTL";
+	case PORT_DRIVE_2MA_REG_OFFSET:         return "GPIODR2R";
+	case PORT_DRIVE_4MA_REG_OFFSET:         return "GPIODR4R";
+	case PORT_DRIVE_8MA_REG_OFFSET:         return "GPIODR8R";
+	case PORT_OPEN_DRAIN_REG_OFFSET:        return "GPIOODR";
+	case PORT_SLEW_RATE_REG_OFFSET:         return "GPIOSLR";
+	default:                                return "GPIO";
+	}
+}
+
+void Port_Sim_Report(void)
+{
+	static const char * const BlockNames[PORT_SIM_BLOCKS] = { "PORTA", "PORTB", "PORTC", "PORTD", "PORTE", "PORTF", "SYSCTL" };
+
+	printf("%-8s %-10s %-6s %8s %8s %8s\n", "block", "register", "offset", "loads", "stores", "cycles");
+	for(uint8 block = 0; block < PORT_SIM_BLOCKS; block++)
+	{
+		for(uint32 word = 0; word < PORT_SIM_BLOCK_WORDS; word++)
+		{
+			const Port_Sim_CountType * count = &Port_Sim_Blocks[block].Count[word];
+			if((count->Loads != 0) || (count->Stores != 0))
+			{
+				printf("%-8s %-10s 0x%03lX %8lu %8lu %8lu\n", BlockNames[block], Port_Sim_RegName(block, word * 4U),
+						(unsigned long)(word * 4U), (unsigned long)count->Loads, (unsigned long)count->Stores,
+						(unsigned long)count->Cycles);
+			}
+		}
+	}
+	printf("%-8s %-10s %-6s %8lu %8lu %8lu  faults %lu\n", "total", "", "", (unsigned long)Port_Sim_Total.Loads,
+			(unsigned long)Port_Sim_Total.Stores, (unsigned long)Port_Sim_Total.Cycles, (unsigned long)Port_Sim_Faults);
+	printf("RCGC2 writes %lu: %lu port clocks enabled, %lu port clocks gated\n", (unsigned long)Port_Sim_Clocks.Writes,
+			(unsigned long)Port_Sim_Clocks.Enables, (unsigned long)Port_Sim_Clocks.Gates);
+
+	printf("\n%-28s %8s %12s %12s %12s\n", "API", "calls", "loads/call", "stores/call", "cycles/call");
+	for(uint8 i = 0; (i < PORT_SIM_MAX_CALLS) && (Port_Sim_Calls[i].Name != NULL); i++)
+	{
+		const Port_Sim_CallType * call = &Port_Sim_Calls[i];
+		printf("%-28s %8lu %12.2f %12.2f %12.2f\n", call->Name, (unsigned long)call->Calls,
+				call->Calls ? (double)call->Count.Loads / call->Calls : 0.0,
+				call->Calls ? (double)call->Count.Stores / call->Calls : 0.0,
+				call->Calls ? (double)call->Count.Cycles / call->Calls : 0.0);
+	}
+}
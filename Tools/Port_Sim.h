@@ -0,0 +1,87 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Sim.h
+ *
+ * Description: Header file for the host register model of the TM4C123GH6PM GPIO ports and
+ *              System Control block, used when PORT_HOST_SIMULATION is STD_ON.
+ *
+ * Author: Mazen Hekal
+ ******************************************************************************/
+
+#ifndef PORT_SIM_H
+#define PORT_SIM_H
+
+#include "Std_Types.h"
+
+/* Number of modelled register blocks: the six GPIO ports followed by System Control */
+#define PORT_SIM_BLOCKS                 (7U)
+#define PORT_SIM_SYSCTL_BLOCK           (6U)
+
+/* Number of 32-bit registers in one 4KB register block */
+#define PORT_SIM_BLOCK_WORDS            (0x400U)
+
+/* Maximum number of API names the per call statistics can hold */
+#define PORT_SIM_MAX_CALLS              (32U)
+
+/* Bus cycles of one access through the APB aperture and through the AHB aperture, back to back accesses */
+#define PORT_SIM_APB_ACCESS_CYCLES      (2U)
+#define PORT_SIM_AHB_ACCESS_CYCLES      (1U)
+
+/* Structure Type to hold bus access counters */
+typedef struct
+{
+	uint32 Loads;
+	uint32 Stores;
+	uint32 Cycles;     /* Bus cycles of the counted accesses */
+}Port_Sim_CountType;
+
+/* Structure Type to hold the port clock changes made through RCGC2 */
+typedef struct
+{
+	uint32 Writes;     /* Stores to RCGC2 */
+	uint32 Enables;    /* Port clocks started by those stores */
+	uint32 Gates;      /* Port clocks stopped by those stores */
+}Port_Sim_ClockType;
+
+/* Bus accesses of the driver */
+uint32 Port_Sim_Read(uint32 Address);
+void Port_Sim_Write(uint32 Address, uint32 Value);
+
+/* Load-exclusive/store-exclusive pair: stores Desired and returns TRUE when the register holds *Expected,
+ * otherwise returns FALSE with the current value in *Expected. Counted as one load and, on success, one store */
+boolean Port_Sim_CompareExchange(uint32 Address, uint32 * Expected, uint32 Desired);
+
+/* Makes every load and store of the driver yield the processor when Yield is TRUE, to force the
+ * interleaving of concurrent threads inside their read-modify-write sequences */
+void Port_Sim_SetYield(boolean Yield);
+
+/* Puts every block back to its reset value and clears all the counters */
+void Port_Sim_Reset(void);
+
+/* Clears the access counters without touching the register contents */
+void Port_Sim_ClearCounters(void);
+
+/* Uncounted accesses for test benches, Poke bypasses the lock and commit protection */
+uint32 Port_Sim_Peek(uint32 Address);
+void Port_Sim_Poke(uint32 Address, uint32 Value);
+
+/* Access counters of the whole model and of one register */
+Port_Sim_CountType Port_Sim_GetTotal(void);
+Port_Sim_CountType Port_Sim_GetRegCount(uint32 Address);
+
+/* Port clock changes made through RCGC2 since the counters were cleared */
+Port_Sim_ClockType Port_Sim_GetClocks(void);
+
+/* Number of accesses to unmapped addresses, to ports whose clock is gated or through the aperture not selected in GPIOHBCTL */
+uint32 Port_Sim_GetFaults(void);
+
+/* Attributes the accesses made between the two calls to the named API */
+void Port_Sim_BeginCall(const char * Name);
+void Port_Sim_EndCall(void);
+
+/* Prints the per register and per API counters to stdout */
+void Port_Sim_Report(void);
+
+#endif /* PORT_SIM_H */
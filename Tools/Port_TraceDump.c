@@ -0,0 +1,195 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_TraceDump.c
+ *
+ * Description: Host side decoder of the trace ring buffer of the Port Driver. Reads a raw
+ *              little endian memory dump of Port_Trace, taken with the debugger or written by
+ *              Port_Bench, lists the recorded calls from the oldest to the newest with the time
+ *              since the previous call, and sums the calls and register stores per service.
+ *              The number of records is taken from the size of the dump, so any
+ *              PORT_TRACE_RECORDS is decoded. A record whose sequence does not match its slot
+ *              was being written when the dump was taken and is reported as such.
+ *
+ *              Build: cc -I.. -I<AUTOSAR include path> Port_TraceDump.c -o Port_TraceDump
+ *              Usage: Port_TraceDump Port_Trace.bin
+ *              e.g. (gdb) dump binary value Port_Trace.bin Port_Trace
+ *
+ * Author: Mazen Hekal
+ ******************************************************************************/
+
+#include <stdio.h>
+
+#include "Port.h"
+
+/* Bytes of the head and of one record in the dump, the layout of Port_TraceBufferType */
+#define TRACEDUMP_HEAD_SIZE       (4U)
+#define TRACEDUMP_RECORD_SIZE     (12U)
+
+/* Largest dump accepted, far above any trace buffer that fits the device RAM */
+#define TRACEDUMP_MAX_RECORDS     (4096U)
+
+/* Number of service IDs of the driver */
+#define TRACEDUMP_SERVICES        (PORT_SETPINOPENDRAIN_SID + 1U)
+
+/* Service names indexed by the service ID */
+static const char * const TraceDump_ServiceNames[TRACEDUMP_SERVICES] =
+{
+	"Port_Init", "Port_SetPinDirection", "Port_RefreshPortDirection", "Port_GetVersionInfo",
+	"Port_SetPinMode", "Port_WritePin", "Port_WritePort", "Port_SetPinGroup",
+	"Port_BeginUpdate", "Port_CommitUpdate", "Port_GetPinDirection", "Port_GetPinMode",
+	"Port_GetPortSnapshot", "Port_GetDriftCount", "Port_GetSweepCount", "Port_VerifyConfiguration",
+	"Port_SwitchConfiguration", "Port_EnterSafeState", "Port_RestoreState", "Port_SetPinDriveStrength",
+	"Port_SetPinSlewRate", "Port_SetPinOpenDrain"
+};
+
+/* Calls and register stores of one service over the decoded records */
+typedef struct
+{
+	uint32 Calls;
+	uint32 Stores;
+	uint32 MaxStores;
+}TraceDump_ServiceType;
+
+static uint32 TraceDump_Get32(const uint8 * Bytes)
+{
+	return (uint32)Bytes[0] | ((uint32)Bytes[1] << 8) | ((uint32)Bytes[2] << 16) | ((uint32)Bytes[3] << 24);
+}
+
+static uint16 TraceDump_Get16(const uint8 * Bytes)
+{
+	return (uint16)(Bytes[0] | (Bytes[1] << 8));
+}
+
+/* Decodes a record from its bytes, in the field order of Port_TraceRecordType */
+static void TraceDump_GetRecord(const uint8 * Bytes, Port_TraceRecordType * Record)
+{
+	Record->timestamp = TraceDump_Get32(&Bytes[0]);
+	Record->sequence = TraceDump_Get16(&Bytes[4]);
+	Record->argument = TraceDump_Get16(&Bytes[6]);
+	Record->service_Id = Bytes[8];
+	Record->pin = Bytes[9];
+	Record->stores = TraceDump_Get16(&Bytes[10]);
+}
+
+/* Formats the pin and argument of a record the way the service takes them */
+static void TraceDump_FormatCall(const Port_TraceRecordType * Record, char * Text, size_t Size)
+{
+	static const char * const drive_Names[] = { "2mA", "4mA", "8mA" };
+
+	switch(Record->service_Id)
+	{
+	case PORT_SETPINDIRECTION_SID:
+		snprintf(Text, Size, "pin %-3u %s", Record->pin, (Record->argument == PORT_PIN_OUT) ? "OUT" : "IN");
+		break;
+	case PORT_SETPINMODE_SID:
+		snprintf(Text, Size, "pin %-3u mode %u", Record->pin, Record->argument);
+		break;
+	case PORT_WRITEPIN_SID:
+		snprintf(Text, Size, "pin %-3u %s", Record->pin, (Record->argument == STD_HIGH) ? "HIGH" : "LOW");
+		break;
+	case PORT_WRITEPORT_SID:
+		snprintf(Text, Size, "PORT%c   mask 0x%02X levels 0x%02X", (Record->pin < PORT_NUMBER_OF_PORTS) ? 'A' + Record->pin : '?',
+				Record->argument >> 8, Record->argument & 0xFFU);
+		break;
+	case PORT_SETPINGROUP_SID:
+		snprintf(Text, Size, "%u changes", Record->argument);
+		break;
+	case PORT_SETPINDRIVESTRENGTH_SID:
+		snprintf(Text, Size, "pin %-3u %s", Record->pin, (Record->argument <= PORT_PIN_DRIVE_8MA) ? drive_Names[Record->argument] : "?");
+		break;
+	case PORT_SETPINSLEWRATE_SID:
+	case PORT_SETPINOPENDRAIN_SID:
+		snprintf(Text, Size, "pin %-3u %s", Record->pin, (Record->argument == TRUE) ? "on" : "off");
+		break;
+	default:
+		snprintf(Text, Size, "%s", (Record->pin == PORT_TRACE_NO_PIN) ? "" : "?");
+		break;
+	}
+}
+
+int main(int argc, char * argv[])
+{
+	static uint8 dump[TRACEDUMP_HEAD_SIZE + (TRACEDUMP_MAX_RECORDS * TRACEDUMP_RECORD_SIZE) + 1U];
+	static TraceDump_ServiceType services[TRACEDUMP_SERVICES];
+	FILE * input;
+	size_t size;
+	uint32 records;
+	uint32 head;
+	uint32 first;
+	uint32 previous_Time = 0;
+	uint32 torn = 0;
+
+	if(argc != 2)
+	{
+		fprintf(stderr, "usage: %s <dump of Port_Trace>\n", argv[0]);
+		return 2;
+	}
+	input = fopen(argv[1], "rb");
+	if(input == NULL)
+	{
+		perror(argv[1]);
+		return 2;
+	}
+	size = fread(dump, 1, sizeof(dump), input);
+	fclose(input);
+	records = (size >= TRACEDUMP_HEAD_SIZE) ? (uint32)((size - TRACEDUMP_HEAD_SIZE) / TRACEDUMP_RECORD_SIZE) : 0;
+	if((records == 0) || (records > TRACEDUMP_MAX_RECORDS) || ((records & (records - 1U)) != 0)
+			|| (size != TRACEDUMP_HEAD_SIZE + (records * TRACEDUMP_RECORD_SIZE)))
+	{
+		fprintf(stderr, "%s: %lu bytes is not a dump of Port_Trace, a head and a power of two of %u byte records\n",
+				argv[1], (unsigned long)size, TRACEDUMP_RECORD_SIZE);
+		return 1;
+	}
+
+	/* The slots hold the last calls, the oldest one is overwritten first */
+	head = TraceDump_Get32(dump);
+	first = (head > records) ? (head - records) : 0;
+	printf("%lu calls recorded, the last %lu of them in %lu slots\n\n", (unsigned long)head,
+			(unsigned long)(head - first), (unsigned long)records);
+	printf("%10s %10s %10s  %-28s %-34s %6s\n", "call", "timestamp", "delta", "service", "pin and argument", "stores");
+
+	for(uint32 call = first; call < head; call++)
+	{
+		Port_TraceRecordType record;
+		char call_Text[40];
+
+		TraceDump_GetRecord(&dump[TRACEDUMP_HEAD_SIZE + ((call & (records - 1U)) * TRACEDUMP_RECORD_SIZE)], &record);
+		if(record.sequence != (uint16)call)
+		{
+			printf("%10lu  being written when the dump was taken\n", (unsigned long)call);
+			torn++;
+			continue;
+		}
+		TraceDump_FormatCall(&record, call_Text, sizeof(call_Text));
+		printf("%10lu %10lu %10lu  %-28s %-34s %6u\n", (unsigned long)call, (unsigned long)record.timestamp,
+				(unsigned long)((call == first) ? 0 : (record.timestamp - previous_Time)),
+				(record.service_Id < TRACEDUMP_SERVICES) ? TraceDump_ServiceNames[record.service_Id] : "unknown service",
+				call_Text, record.stores);
+		previous_Time = record.timestamp;
+
+		if(record.service_Id < TRACEDUMP_SERVICES)
+		{
+			TraceDump_ServiceType * service = &services[record.service_Id];
+			service->Calls++;
+			service->Stores += record.stores;
+			service->MaxStores = (record.stores > service->MaxStores) ? record.stores : service->MaxStores;
+		}
+	}
+
+	printf("\n%-28s %8s %10s %10s\n", "service", "calls", "stores", "max");
+	for(uint8 sid = 0; sid < TRACEDUMP_SERVICES; sid++)
+	{
+		if(services[sid].Calls != 0)
+		{
+			printf("%-28s %8lu %10lu %10lu\n", TraceDump_ServiceNames[sid], (unsigned long)services[sid].Calls,
+					(unsigned long)services[sid].Stores, (unsigned long)services[sid].MaxStores);
+		}
+	}
+	if(torn != 0)
+	{
+		printf("%lu record(s) being written were skipped\n", (unsigned long)torn);
+	}
+	return 0;
+}